@@ -75,6 +75,14 @@ HSQUIRRELVM sq_newthread(HSQUIRRELVM friendvm, SQInteger initialstacksize)
     }
 }
 
+SQRESULT sq_resetthread(HSQUIRRELVM friendvm, HSQUIRRELVM v)
+{
+    //the thread can't be reset while something else than the caller references it
+    if(v->_uiRef > 1 || !v->Reset(friendvm))
+        return SQ_ERROR;
+    return SQ_OK;
+}
+
 SQInteger sq_getvmstate(HSQUIRRELVM v)
 {
     if(v->_suspended)
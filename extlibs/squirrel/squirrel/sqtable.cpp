@@ -13,6 +13,7 @@ SQTable::SQTable(SQSharedState *ss,SQInteger nInitialSize)
     while(nInitialSize>pow2size)pow2size=pow2size<<1;
     AllocNodes(pow2size);
     _usednodes = 0;
+    _version = 0;
     _delegate = NULL;
     INIT_CHAIN();
     ADD_TO_CHAIN(&_sharedstate->_gc_chain,this);
@@ -26,6 +27,7 @@ void SQTable::Remove(const SQObjectPtr &key)
         n->val.Null();
         n->key.Null();
         _usednodes--;
+        _version++;
         Rehash(false);
     }
 }
@@ -119,6 +121,7 @@ bool SQTable::Get(const SQObjectPtr &key,SQObjectPtr &val)
 bool SQTable::NewSlot(const SQObjectPtr &key,const SQObjectPtr &val)
 {
     assert(sq_type(key) != OT_NULL);
+    _version++;
     SQHash h = HashObj(key) & (_numofnodes - 1);
     _HashNode *n = _Get(key, h);
     if (n) {
@@ -197,6 +200,7 @@ bool SQTable::Set(const SQObjectPtr &key, const SQObjectPtr &val)
     _HashNode *n = _Get(key, HashObj(key) & (_numofnodes - 1));
     if (n) {
         n->val = val;
+        _version++;
         return true;
     }
     return false;
@@ -205,6 +209,7 @@ bool SQTable::Set(const SQObjectPtr &key, const SQObjectPtr &val)
 void SQTable::_ClearNodes()
 {
     for(SQInteger i = 0;i < _numofnodes; i++) { _HashNode &n = _nodes[i]; n.key.Null(); n.val.Null(); }
+    _version++;
 }
 
 void SQTable::Finalize()
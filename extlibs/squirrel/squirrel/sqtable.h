@@ -36,6 +36,7 @@ private:
     _HashNode *_nodes;
     SQInteger _numofnodes;
     SQInteger _usednodes;
+    SQUnsignedInteger _version;
 
 ///////////////////////////
     void AllocNodes(SQInteger nSize);
@@ -99,6 +100,8 @@ public:
     SQInteger Next(bool getweakrefs,const SQObjectPtr &refpos, SQObjectPtr &outkey, SQObjectPtr &outval);
 
     SQInteger CountUsed(){ return _usednodes;}
+    //incremented each time a slot is added, written or removed
+    SQUnsignedInteger GetVersion(){ return _version;}
     void Clear();
     void Release()
     {
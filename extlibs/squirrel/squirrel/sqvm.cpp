@@ -374,6 +374,32 @@ bool SQVM::Init(SQVM *friendvm, SQInteger stacksize)
 }
 
 
+//resets an idle thread so it can be reused as if it was created by friendvm
+bool SQVM::Reset(SQVM *friendvm)
+{
+    if(_callsstacksize != 0 || _suspended || _nnativecalls != 0) return false;
+    if(_openouters) CloseOuters(&_stack._vals[0]);
+    SQInteger size=_stack.size();
+    for(SQInteger i=0;i<size;i++)
+        _stack[i].Null();
+    _etraps.resize(0);
+    _top = 0;
+    _stackbase = 0;
+    ci = NULL;
+    _lasterror.Null();
+    temp_reg.Null();
+    _nmetamethodscall = 0;
+    _suspended_target = -1;
+    _suspended_root = SQFalse;
+    _suspended_traps = -1;
+    _roottable = friendvm->_roottable;
+    _errorhandler = friendvm->_errorhandler;
+    _debughook = friendvm->_debughook;
+    _debughook_native = friendvm->_debughook_native;
+    _debughook_closure = friendvm->_debughook_closure;
+    return true;
+}
+
 bool SQVM::StartCall(SQClosure *closure,SQInteger target,SQInteger args,SQInteger stackbase,bool tailcall)
 {
     SQFunctionProto *func = closure->_function;
@@ -1184,9 +1210,19 @@ bool SQVM::CallNative(SQNativeClosure *nclosure, SQInteger nargs, SQInteger newb
         _stack._vals[newbase] = nclosure->_env->_obj;
     }
 
+    //native closures are reported to the native debug hook as 'n' (call) and 'x' (return)
+    bool debughook = _debughook && _debughook_native;
+    const SQChar *fname = NULL;
+    if(debughook) {
+        fname = sq_type(nclosure->_name) == OT_STRING?_stringval(nclosure->_name):NULL;
+        _debughook_native(this,_SC('n'),NULL,0,fname);
+    }
     _nnativecalls++;
     SQInteger ret = (nclosure->_function)(this);
     _nnativecalls--;
+    if(debughook) {
+        _debughook_native(this,_SC('x'),NULL,0,fname);
+    }
 
     suspend = false;
 	tailcall = false;
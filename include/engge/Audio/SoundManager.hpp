@@ -19,6 +19,10 @@ public:
   void setEngine(Engine *pEngine) { m_pEngine = pEngine; }
   [[nodiscard]] Engine *getEngine() const { return m_pEngine; }
 
+  /// When the audio is disabled, no sound is played and the audio system is never used.
+  void setAudioEnabled(bool enabled) { m_isAudioEnabled = enabled; }
+  [[nodiscard]] bool isAudioEnabled() const { return m_isAudioEnabled; }
+
   std::shared_ptr<SoundDefinition> defineSound(const std::string &name);
   std::shared_ptr<SoundId> playSound(std::shared_ptr<SoundDefinition> soundDefinition,
                                      int loopTimes = 1,
@@ -65,6 +69,7 @@ private:
                                 int loopTimes = 1,
                                 const ngf::TimeSpan &fadeInTime = ngf::TimeSpan::Zero,
                                 int id = 0);
+  static void signal(const SoundId *pSoundId);
 
 private:
   std::vector<std::shared_ptr<SoundDefinition>> m_sounds;
@@ -74,6 +79,7 @@ private:
   float m_soundVolume{1};
   float m_musicVolume{1};
   float m_talkVolume{1};
+  bool m_isAudioEnabled{true};
   std::shared_ptr<SoundDefinition> m_pSoundHover{nullptr};
 };
 } // namespace ng
\ No newline at end of file
@@ -1,6 +1,10 @@
 #pragma once
 #include <array>
+#include <deque>
+#include <list>
+#include <memory>
 #include <optional>
+#include <unordered_map>
 #include <ngf/Graphics/Drawable.h>
 #include "engge/Parsers/YackParser.hpp"
 #include "engge/Engine/Function.hpp"
@@ -11,6 +15,7 @@
 namespace ng {
 class Actor;
 class Engine;
+class Room;
 
 struct DialogSlot {
   std::wstring text;
@@ -24,6 +29,15 @@ public:
   void start(const std::string &actor, const std::string &name, const std::string &node);
   void update(const ngf::TimeSpan &elapsed);
 
+  /// @brief Gets the parsed dialog with the specified name, parsing it if it's not in the cache.
+  std::shared_ptr<const Ast::CompilationUnit> getCompilationUnit(const std::string &name);
+  /// @brief Parses the dialog with the specified name if it's not in the cache yet.
+  /// An invalid dialog is logged, it fails only when it is started.
+  void warm(const std::string &name);
+  /// @brief Queues the dialogs of the actors and objects in the specified room, they are parsed
+  /// a few at a time by update().
+  void warm(const Room &room);
+
   void setMousePosition(glm::vec2 pos);
 
   const std::vector<DialogConditionState> &getStates() const { return m_pPlayer->getStates(); }
@@ -39,11 +53,19 @@ private:
   static void onDialogEnded();
 
 private:
+  using CompilationUnits = std::list<std::pair<std::string, std::shared_ptr<const Ast::CompilationUnit>>>;
+  static constexpr size_t MaxCompilationUnits = 16;
+  static constexpr size_t MaxWarmedDialogsPerUpdate = 1;
+
   Engine *m_pEngine{nullptr};
   DialogManagerState m_state{DialogManagerState::None};
   glm::vec2 m_mousePos{0, 0};
   std::unique_ptr<EngineDialogScript> m_pEngineDialogScript;
   std::unique_ptr<DialogPlayer> m_pPlayer;
   std::array<DialogSlot, 9> m_slots;
+  // parsed dialogs, the most recently used first
+  CompilationUnits m_compilationUnits;
+  std::unordered_map<std::string, CompilationUnits::iterator> m_compilationUnitMap;
+  std::deque<std::string> m_dialogsToWarm;
 };
 } // namespace ng
@@ -46,7 +46,10 @@ public:
   explicit DialogPlayer(DialogScriptAbstract &script);
   ~DialogPlayer() override;
 
-  void start(const std::string &actor, const std::string &name, const std::string &node);
+  void start(const std::string &actor,
+             const std::string &name,
+             std::shared_ptr<const Ast::CompilationUnit> compilationUnit,
+             const std::string &node);
   void choose(int choiceId);
   void update();
 
@@ -62,7 +65,7 @@ private:
   void resetState();
 
   void selectLabel(const std::string &name);
-  void run(Ast::Statement *pStatement);
+  void run(const Ast::Statement *pStatement);
 
   void addChoice(const Ast::Statement *pStatement, const Ast::Choice *pChoice);
   void clearChoices();
@@ -95,9 +98,9 @@ private:
 
 private:
   std::string m_dialogName;
-  std::unique_ptr<Ast::CompilationUnit> m_pCompilationUnit;
+  std::shared_ptr<const Ast::CompilationUnit> m_pCompilationUnit;
   std::array<const Ast::Statement *, 9> m_choices{};
-  Ast::Label *m_pLabel{nullptr};
+  const Ast::Label *m_pLabel{nullptr};
   int m_currentStatement{0};
   DialogPlayerState m_state{DialogPlayerState::None};
   std::string m_actor;
@@ -1,6 +1,11 @@
 #pragma once
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
 #include <ngf/Application.h>
 #include <ngf/System/Event.h>
+#include <ngf/System/StopWatch.h>
 #include <ngf/System/TimeSpan.h>
 #include <ngf/Graphics/RenderTarget.h>
 #include <ngf/Graphics/RenderStates.h>
@@ -13,11 +18,31 @@
 namespace ng {
 
 class Engine;
+class InputRecorder;
+class ReplayInputSource;
+
+/// @brief Options of the headless mode, used to run the game without a user.
+struct HeadlessOptions {
+  /// Number of frames to update before quitting.
+  int frames{600};
+  /// Number of frames per second, each update is called with an elapsed time of 1/frameRate.
+  int frameRate{60};
+  /// Path of the input script played by a `ScriptedInputSource`, the mouse is not used when it's empty.
+  std::string inputPath;
+};
 
 class EnggeApplication final : public ngf::Application {
 public:
   ngf::AudioSystem &getAudioSystem() { return m_audioSystem; }
 
+  /// Runs the game without drawing and without audio, the statistics of the updates are logged on exit.
+  void setHeadless(const HeadlessOptions &options);
+  [[nodiscard]] bool isHeadless() const { return m_isHeadless; }
+  /// Records the input of the run to a file.
+  void setInputRecordingPath(const std::filesystem::path &path) { m_inputRecordingPath = path; }
+  /// Replays the input recorded in a file instead of reading the mouse and the keyboard, then quits.
+  void setInputReplayPath(const std::filesystem::path &path) { m_inputReplayPath = path; }
+
 private:
   void onInit() final;
   void onEvent(ngf::Event &event) final;
@@ -25,13 +50,29 @@ private:
   void onImGuiRender() final;
   void onUpdate(const ngf::TimeSpan &elapsed) final;
   void onQuit() final;
+  void logUpdateStats();
 
 private:
+  /// Longest frame time simulated, the rest is dropped to avoid a spiral of death.
+  static constexpr float MaxFrameTime = 0.25f;
+  /// Maximum number of fixed steps done in a single frame.
+  static constexpr int MaxStepsPerFrame = 8;
+
   ng::Engine *m_engine{nullptr};
   bool m_init{false};
   glm::ivec2 m_pos;
   bool m_isMousePressed{false};
   bool m_isKeyPressed{false};
+  float m_accumulator{0};
   std::unique_ptr<DebugTools> m_debugTools;
+  bool m_isHeadless{false};
+  HeadlessOptions m_headlessOptions;
+  std::filesystem::path m_inputRecordingPath;
+  std::filesystem::path m_inputReplayPath;
+  std::unique_ptr<InputRecorder> m_inputRecorder;
+  std::shared_ptr<ReplayInputSource> m_inputReplay;
+  std::vector<ngf::TimeSpan> m_updateTimes;
+  float m_simulatedTime{0};
+  ngf::StopWatch m_runClock;
 };
 }
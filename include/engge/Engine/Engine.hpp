@@ -18,6 +18,7 @@ class DialogManager;
 class EnggeApplication;
 class Entity;
 class Function;
+class InputRecorder;
 class Inventory;
 class Object;
 class Preferences;
@@ -27,7 +28,9 @@ class Sentence;
 class SoundDefinition;
 class SoundManager;
 class ResourceManager;
+class RoomPrefetcher;
 class ThreadBase;
+class ThreadPool;
 struct Verb;
 class VerbExecute;
 
@@ -88,6 +91,7 @@ public:
   Actor *getCurrentActor();
   Entity *getEntity(const std::string &name);
 
+  void addTimer(std::unique_ptr<TimeFunction> function);
   void addCallback(std::unique_ptr<Callback> callback);
   void removeCallback(int id);
 
@@ -125,6 +129,9 @@ public:
 
   void addThread(std::unique_ptr<ThreadBase> thread);
   std::vector<std::unique_ptr<ThreadBase>> &getThreads();
+  ThreadBase *getThread(int id);
+  ThreadBase *getThread(HSQUIRRELVM v);
+  ThreadPool &getThreadPool();
 
   void startDialog(const std::string &dialog, const std::string &node);
   void execute(const std::string &code);
@@ -139,6 +146,7 @@ public:
   SoundManager &getSoundManager();
   DialogManager &getDialogManager();
   ResourceManager &getResourceManager();
+  RoomPrefetcher &getRoomPrefetcher();
 
   Camera &getCamera();
   void follow(Actor *pActor);
@@ -155,6 +163,10 @@ public:
 
   [[nodiscard]] ngf::TimeSpan getTime() const;
 
+  /// Sets the time elapsed since the last update, in steps, used to interpolate the entities when drawing.
+  void setRenderInterpolation(float alpha);
+  [[nodiscard]] float getRenderInterpolation() const;
+
   HSQOBJECT &getDefaultObject();
 
   /// Fades the screen with the specified effect and duration.
@@ -165,6 +177,8 @@ public:
 
   void keyDown(const Input &key);
   void keyUp(const Input &key);
+  /// Sets the recorder of the key events and of the input sampled at each update, it can be null.
+  void setInputRecorder(InputRecorder *pRecorder);
 
   void sayLineAt(glm::ivec2 pos, ngf::Color color, ngf::TimeSpan duration, const std::string &text);
   void sayLineAt(glm::ivec2 pos, Entity &entity, const std::string &text);
@@ -2,9 +2,12 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
 #include <filesystem>
+#include <unordered_map>
 #include <ngf/IO/GGPackValue.h>
 #include <ngf/IO/GGPack.h>
+#include "EntryView.hpp"
 
 namespace ng {
 class EngineSettings {
@@ -12,14 +15,30 @@ public:
   using iterator = std::vector<std::unique_ptr<ngf::GGPack>>::iterator;
   using const_iterator = std::vector<std::unique_ptr<ngf::GGPack>>::const_iterator;
 
+  /// @brief Location of an entry in the virtual filesystem.
+  /// An entry can be a loose file in the working directory, an entry in a ggpack or both,
+  /// in that case the loose file is used for raw reads.
+  /// The entries are indexed once by `loadPacks`, only the files at the top of the working directory
+  /// are indexed and the files created later are not.
+  struct Entry {
+    ngf::GGPack *pack{nullptr};
+    std::filesystem::path file;
+  };
+
 public:
   [[nodiscard]] std::filesystem::path getPath() const;
   void loadPacks();
 
   [[nodiscard]] int getPackCount() const { return static_cast<int>(m_packs.size()); }
 
-  bool hasEntry(const std::string &name);
+  [[nodiscard]] bool hasEntry(const std::string &name) const;
+  [[nodiscard]] const Entry *getEntry(const std::string &name) const;
   [[nodiscard]] std::vector<char> readBuffer(const std::string &name) const;
+  /// @brief Gets a view on the content of an entry without any intermediate copy.
+  /// Loose files are memory-mapped, pack entries are decoded into the view's buffer.
+  /// \param nullTerminated: true for the text parsers expecting a C string. As the pack returns a buffer
+  /// of the exact size, a pack entry is then copied once to append the null character.
+  [[nodiscard]] EntryView readView(const std::string &name, bool nullTerminated = true) const;
   [[nodiscard]] ngf::GGPackValue readEntry(const std::string &name) const;
 
   iterator begin() { return m_packs.begin(); }
@@ -28,7 +47,13 @@ public:
   [[nodiscard]] const_iterator cbegin() const { return m_packs.cbegin(); }
   [[nodiscard]] const_iterator cend() const { return m_packs.cend(); }
 
+private:
+  void indexEntries();
+
 private:
   std::vector<std::unique_ptr<ngf::GGPack>> m_packs;
+  std::unordered_map<std::string, Entry> m_entries;
+  // a pack has a single file stream, reads can come from the texture decoding threads
+  mutable std::mutex m_packMutex;
 };
 } // namespace ng
@@ -1,4 +1,6 @@
 #pragma once
+#include <cstddef>
+#include <vector>
 #include <squirrel.h>
 #include <engge/Room/Room.hpp>
 #include <engge/Engine/Engine.hpp>
@@ -41,9 +43,19 @@ public:
   inline void setCallbackId(int id) { m_callbackId = id - START_CALLBACKID; }
   inline int getThreadId() { return START_THREADID + m_threadId++; }
 
+  void addActor(Actor *pActor);
+  void removeActor(const Actor *pActor);
+  void addRoom(Room *pRoom);
+  void removeRoom(const Room *pRoom);
+  void addObject(Object *pObject);
+  void removeObject(const Object *pObject);
+  void addLight(Light *pLight);
+  void removeLight(const Light *pLight);
+
   static Actor *getActorFromId(int id);
   static Room *getRoomFromId(int id);
   static Object *getObjectFromId(int id);
+  static Light *getLightFromId(int id);
   static Sound *getSoundFromId(int id);
   static ThreadBase *getThreadFromId(int id);
   static ThreadBase *getThreadFromVm(HSQUIRRELVM v);
@@ -75,6 +87,13 @@ public:
 private:
   static inline bool isBetween(int id, int min, int max) { return id >= min && id < max; }
 
+  template<typename T>
+  static void setSlot(std::vector<T *> &slots, std::size_t index, T *pValue);
+  template<typename T>
+  static void resetSlot(std::vector<T *> &slots, std::size_t index, const T *pValue);
+  template<typename T>
+  static T *getSlot(const std::vector<T *> &slots, int index);
+
 private:
   int m_actorId{0};
   int m_roomId{0};
@@ -83,6 +102,11 @@ private:
   int m_soundId{0};
   int m_callbackId{0};
   int m_threadId{0};
+  // live entities indexed by id - START_*, filled as they are constructed/destroyed
+  std::vector<Actor *> m_actors;
+  std::vector<Room *> m_rooms;
+  std::vector<Object *> m_objects;
+  std::vector<Light *> m_lights;
 };
 
 template<typename TScriptObject>
@@ -129,13 +153,7 @@ TScriptObject *EntityManager::getScriptObjectFromId(int id) {
   }
 
   if (EntityManager::isLight(id)) {
-    for (auto &&room : ng::Locator<ng::Engine>::get().getRooms()) {
-      for (auto &light : room->getLights()) {
-        if (light.getId() == id)
-          return dynamic_cast<TScriptObject *>(&light);
-      }
-    }
-    return nullptr;
+    return dynamic_cast<TScriptObject *>(getLightFromId(id));
   }
 
   if (EntityManager::isObject(id)) {
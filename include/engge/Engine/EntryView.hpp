@@ -0,0 +1,39 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace ng {
+/// @brief Read-only, reference counted view on the content of an entry.
+/// The content of a null terminated view is followed by a null character which is not counted in the size,
+/// so it can be given directly to parsers expecting a C string.
+class EntryView {
+public:
+  EntryView() = default;
+  EntryView(std::shared_ptr<const char> data, std::size_t size)
+      : m_data(std::move(data)), m_size(size) {}
+
+  /// When null terminated, a null character is appended to the buffer: reserve one more byte to avoid
+  /// a reallocation. Binary contents don't need it.
+  explicit EntryView(std::vector<char> buffer, bool nullTerminated = true) {
+    m_size = buffer.size();
+    if (nullTerminated)
+      buffer.push_back('\0');
+    auto pBuffer = std::make_shared<std::vector<char>>(std::move(buffer));
+    m_data = std::shared_ptr<const char>(pBuffer, pBuffer->data());
+  }
+
+  [[nodiscard]] const char *data() const { return m_data ? m_data.get() : ""; }
+  [[nodiscard]] std::size_t size() const { return m_size; }
+  [[nodiscard]] bool empty() const { return m_size == 0; }
+
+  [[nodiscard]] const char *begin() const { return data(); }
+  [[nodiscard]] const char *end() const { return data() + m_size; }
+
+  [[nodiscard]] char operator[](std::size_t index) const { return m_data.get()[index]; }
+
+private:
+  std::shared_ptr<const char> m_data;
+  std::size_t m_size{0};
+};
+} // namespace ng
@@ -1,6 +1,8 @@
 #pragma once
 #include <string>
 #include <functional>
+#include <optional>
+#include <engge/Engine/WaitKey.hpp>
 #include <engge/System/NonCopyable.hpp>
 #include <ngf/System/TimeSpan.h>
 
@@ -9,6 +11,8 @@ class Function : public NonCopyable {
 public:
   virtual bool isElapsed() { return true; }
   virtual void operator()(const ngf::TimeSpan &) {}
+  /// Gets the event to wait for before updating this function again, when it's not elapsed.
+  [[nodiscard]] virtual std::optional<WaitKey> getWaitKey() const { return std::nullopt; }
   virtual ~Function() = default;
 };
 } // namespace ng
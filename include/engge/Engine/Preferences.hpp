@@ -2,6 +2,8 @@
 #include <functional>
 #include <map>
 #include <string>
+#include <utility>
+#include <vector>
 #include <ngf/IO/GGPackValue.h>
 
 namespace ng {
@@ -38,6 +40,8 @@ static const std::string KeySelectNext = "keySelectNext";
 // engge only
 static const std::string EnggeGameSpeedFactor = "gameSpeedFactor";
 static const std::string EnggeDevPath = "devPath";
+static const std::string EnggeTextureBudget = "textureBudget";
+static const std::string EnggeUpdateRate = "updateRate";
 static const bool EnggeDebug = false;
 }
 
@@ -73,6 +77,8 @@ static const std::string KeySelectNext = "0";
 static const bool AnnoyingInJokes = false;
 static const std::string EnggeDevPath = "";
 static const float EnggeGameSpeedFactor = 1.f;
+static const int EnggeTextureBudget = 512; // in MB
+static const int EnggeUpdateRate = 60; // in Hz, 0 to update once per frame
 static const bool EnggeDebug = false;
 }
 
@@ -104,7 +110,10 @@ public:
 
   void removeUserPreference(const std::string &name);
 
-  void subscribe(const std::function<void(const std::string &)> &function);
+  /// Calls the function each time a user preference is set.
+  /// \return the identifier of the subscription, to give to `unsubscribe`.
+  int subscribe(const std::function<void(const std::string &)> &function);
+  void unsubscribe(int id);
 
   template<typename T>
   static ngf::GGPackValue toGGPackValue(T value);
@@ -121,14 +130,15 @@ private:
 private:
   ngf::GGPackValue m_values;
   ngf::GGPackValue m_tempValues;
-  std::vector<std::function<void(const std::string &)>> m_functions;
+  std::vector<std::pair<int, std::function<void(const std::string &)>>> m_functions;
+  int m_nextSubscriptionId{1};
 };
 
 template<typename T>
 void Preferences::setUserPreference(const std::string &name, T value) {
   m_values[name] = value;
   for (auto &&func : m_functions) {
-    func(name);
+    func.second(name);
   }
 }
 
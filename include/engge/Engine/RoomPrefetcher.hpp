@@ -0,0 +1,42 @@
+#pragma once
+#include <unordered_map>
+
+namespace ng {
+class Engine;
+class Entity;
+class Object;
+class Room;
+struct Animation;
+
+/// @brief Prefetches the textures of a room before the player enters it.
+/// @details The destination of a door is learnt each time a room is entered from a door:
+/// the door the actor walked to in the previous room leads to the new room, and the door
+/// used to enter the new room leads back to the previous one.
+class RoomPrefetcher {
+public:
+  void setEngine(Engine *pEngine) { m_pEngine = pEngine; }
+
+  /// @brief Called when an actor starts walking to an entity.
+  /// If the entity is a door with a known destination, the destination is prefetched.
+  void onWalkTo(const Entity &entity);
+  /// @brief Called when the screen starts fading out, prefetches the destination of the last door walked to.
+  void onFadeOut();
+  /// @brief Called when a room is entered from a door, learns where the doors lead to.
+  /// \param pFromRoom Room the actor comes from.
+  /// \param door Door used to enter the new room.
+  void onEnterRoomFromDoor(const Room *pFromRoom, const Object &door);
+
+  /// @brief Requests the background decoding of the textures used by the room, its objects and its actors.
+  void prefetch(const Room &room);
+
+private:
+  static void prefetch(const Animation &animation);
+  [[nodiscard]] const Room *getDestination(int doorId) const;
+
+private:
+  Engine *m_pEngine{nullptr};
+  std::unordered_map<int, const Room *> m_doorDestinations;
+  int m_lastDoorId{0};
+  const Room *m_pLastDoorRoom{nullptr};
+};
+} // namespace ng
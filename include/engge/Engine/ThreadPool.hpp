@@ -0,0 +1,38 @@
+#pragma once
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+#include <squirrel.h>
+
+namespace ng {
+/// Reuses the Squirrel threads of the script threads and room triggers instead of creating a VM each time.
+class ThreadPool final {
+public:
+  struct Stats {
+    std::size_t created{0};
+    std::size_t reused{0};
+    std::size_t recycled{0};
+    std::size_t released{0};
+  };
+
+  ThreadPool();
+  ~ThreadPool();
+
+  /// Gets a thread and pushes it on the stack of `v` like `sq_newthread`.
+  HSQUIRRELVM acquire(HSQUIRRELVM v);
+  /// Gives back a thread once its script thread has been destroyed, it's kept only if it can be reset.
+  void recycle(HSQUIRRELVM thread);
+
+  [[nodiscard]] const Stats &getStats() const { return m_stats; }
+  [[nodiscard]] std::size_t getUsedSize() const { return m_used.size(); }
+  [[nodiscard]] std::size_t getFreeSize() const { return m_free.size(); }
+
+private:
+  void release(HSQOBJECT &thread);
+
+private:
+  std::unordered_map<HSQUIRRELVM, HSQOBJECT> m_used;
+  std::vector<HSQOBJECT> m_free;
+  Stats m_stats;
+};
+} // namespace ng
@@ -10,6 +10,7 @@ public:
 
   void operator()(const ngf::TimeSpan &elapsed) override;
   [[nodiscard]] ngf::TimeSpan getElapsed() const;
+  [[nodiscard]] ngf::TimeSpan getDuration() const;
 
   bool isElapsed() override;
 
@@ -0,0 +1,79 @@
+#pragma once
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <ngf/System/TimeSpan.h>
+#include <engge/Engine/TimeFunction.hpp>
+
+namespace ng {
+/// Keeps time functions ordered by the game time at which they elapse,
+/// so that each update only touches the functions that have elapsed.
+template<typename TFunction>
+class TimerQueue final {
+private:
+  struct Timer {
+    double start;
+    double deadline;
+    std::unique_ptr<TFunction> function;
+  };
+
+public:
+  void add(std::unique_ptr<TFunction> function) {
+    auto deadline = m_time + function->getDuration().getTotalSeconds();
+    m_timers.push_back(Timer{m_time, deadline, std::move(function)});
+    std::push_heap(m_timers.begin(), m_timers.end(), later);
+  }
+
+  template<typename TPredicate>
+  void removeIf(TPredicate predicate) {
+    auto it = std::remove_if(m_timers.begin(), m_timers.end(), [&predicate](const Timer &timer) {
+      return predicate(*timer.function);
+    });
+    if (it == m_timers.end())
+      return;
+    m_timers.erase(it, m_timers.end());
+    std::make_heap(m_timers.begin(), m_timers.end(), later);
+  }
+
+  void clear() { m_timers.clear(); }
+
+  /// Calls f(function, elapsed) for each pending function, elapsed being its time elapsed so far.
+  template<typename TFunc>
+  void forEach(TFunc f) const {
+    for (const auto &timer : m_timers) {
+      f(*timer.function, ngf::TimeSpan::seconds(static_cast<float>(m_time - timer.start)));
+    }
+  }
+
+  void update(const ngf::TimeSpan &elapsed) {
+    m_time += elapsed.getTotalSeconds();
+    std::vector<Timer> pending;
+    while (!m_timers.empty() && m_timers.front().deadline < m_time) {
+      std::pop_heap(m_timers.begin(), m_timers.end(), later);
+      auto timer = std::move(m_timers.back());
+      m_timers.pop_back();
+
+      // catch up with the time elapsed since the function has been added,
+      // this can add or remove timers
+      auto &function = *timer.function;
+      auto delta = m_time - timer.start - function.getElapsed().getTotalSeconds();
+      function(ngf::TimeSpan::seconds(static_cast<float>(delta)));
+      if (!function.isElapsed()) {
+        timer.deadline = m_time;
+        pending.push_back(std::move(timer));
+      }
+    }
+    for (auto &timer : pending) {
+      m_timers.push_back(std::move(timer));
+      std::push_heap(m_timers.begin(), m_timers.end(), later);
+    }
+  }
+
+private:
+  static bool later(const Timer &a, const Timer &b) { return a.deadline > b.deadline; }
+
+private:
+  std::vector<Timer> m_timers;
+  double m_time{0};
+};
+} // namespace ng
@@ -0,0 +1,21 @@
+#pragma once
+#include <tuple>
+
+namespace ng {
+enum class WaitEvent {
+  Animation,
+  Walk,
+  Talk,
+  Sound
+};
+
+/// Identifies an event a suspended function waits for, and the object it concerns (nullptr for any object).
+struct WaitKey {
+  WaitEvent event;
+  const void *pObject{nullptr};
+
+  bool operator<(const WaitKey &other) const {
+    return std::tie(event, pObject) < std::tie(other.event, other.pObject);
+  }
+};
+} // namespace ng
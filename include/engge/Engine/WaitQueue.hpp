@@ -0,0 +1,26 @@
+#pragma once
+#include <map>
+#include <memory>
+#include <vector>
+#include <engge/Engine/Function.hpp>
+#include <engge/Engine/WaitKey.hpp>
+
+namespace ng {
+/// Parks the functions waiting for an event until the producer of this event signals it.
+class WaitQueue final {
+public:
+  WaitQueue();
+  ~WaitQueue();
+
+  /// Parks a function until its wait key is signaled.
+  void wait(std::unique_ptr<Function> function);
+  /// Wakes up the functions waiting for this event on this object.
+  void signal(WaitEvent event, const void *pObject);
+  /// Gets the functions woken up since the last call.
+  std::vector<std::unique_ptr<Function>> takeSignaled();
+
+private:
+  std::map<WaitKey, std::vector<std::unique_ptr<Function>>> m_waiting;
+  std::vector<std::unique_ptr<Function>> m_signaled;
+};
+} // namespace ng
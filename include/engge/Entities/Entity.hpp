@@ -64,6 +64,10 @@ public:
   [[nodiscard]] glm::vec2 getPosition() const;
   [[nodiscard]] glm::vec2 getRealPosition() const;
   [[nodiscard]] ngf::Transform getTransform() const;
+  /// Gets the transform used to draw the entity, interpolated between the two last updates.
+  [[nodiscard]] ngf::Transform getRenderTransform() const;
+  /// Keeps the current position to interpolate it with the position of the next update.
+  void savePreviousPosition();
 
   void setOffset(const glm::vec2 &offset);
   [[nodiscard]] glm::vec2 getOffset() const;
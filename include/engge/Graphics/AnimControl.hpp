@@ -20,6 +20,7 @@ public:
   [[nodiscard]] bool getLoop() const;
 
 private:
+  void signal() const;
   static void resetAnim(Animation &anim);
   static void rewind(Animation &anim);
   void update(const ngf::TimeSpan &e, Animation &animation) const;
@@ -1,11 +1,18 @@
 #pragma once
+#include <condition_variable>
+#include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
 #include <engge/System/NonCopyable.hpp>
 #include <ngf/Graphics/Texture.h>
 
 namespace ngf {
 class FntFont;
+class Image;
 }
 
 namespace ng {
@@ -14,7 +21,9 @@ class SpriteSheet;
 
 struct TextureResource {
   std::shared_ptr<ngf::Texture> texture;
-  size_t size;
+  size_t size;        ///< size of the compressed image file
+  size_t memorySize;  ///< size of the decoded texture (RGBA)
+  int lastUsedFrame;
 };
 
 class ResourceManager : public NonCopyable {
@@ -22,15 +31,45 @@ public:
   ResourceManager();
   ~ResourceManager();
 
+  /// @brief Gets the texture with the specified id.
+  /// If the texture is not loaded yet, its decoding is requested and a transparent placeholder
+  /// is returned until the texture has been uploaded by uploadDecodedTextures().
   std::shared_ptr<ngf::Texture> getTexture(const std::string &id);
+  /// @brief Gets the texture with the specified id, decoding and uploading it now if needed.
+  std::shared_ptr<ngf::Texture> getLoadedTexture(const std::string &id);
+  /// @brief Requests the texture to be decoded in background, useful to prefetch textures.
+  void requestTexture(const std::string &id);
+  [[nodiscard]] bool isTextureLoaded(const std::string &id) const;
+
   GGFont &getFont(const std::string &id);
   ngf::FntFont &getFntFont(const std::string &id);
   const SpriteSheet &getSpriteSheet(const std::string &id);
 
+  /// @brief Uploads the textures decoded in background, has to be called from the main thread.
+  void uploadDecodedTextures();
+  /// @brief Starts a new rendered frame and evicts the textures not used by the last ones if needed.
+  /// Called once per rendered frame, the textures drawn by the previous frame are kept.
+  void newFrame();
+
   [[nodiscard]] const std::map<std::string, TextureResource> &getTextureMap() const { return m_textureMap; }
+  [[nodiscard]] size_t getPendingTextureCount() const { return m_pendingTextures.size(); }
+  [[nodiscard]] size_t getTextureMemory() const { return m_textureMemory; }
+  [[nodiscard]] size_t getTextureBudget() const { return m_textureBudget; }
+  /// @brief Sets the memory budget of the textures, in bytes.
+  /// When the budget is exceeded, the least recently used textures not referenced anymore are evicted.
+  void setTextureBudget(size_t budget) { m_textureBudget = budget; }
 
 private:
-  void load(const std::string &id);
+  struct DecodedImage {
+    std::string id;
+    std::unique_ptr<ngf::Image> image;
+    size_t size{0};
+  };
+
+  static DecodedImage decode(const std::string &id);
+  void upload(DecodedImage &decoded);
+  void evictTextures();
+  void decodeLoop();
   void loadFont(const std::string &id);
   void loadFntFont(const std::string &id);
   void loadSpriteSheet(const std::string &id);
@@ -40,5 +79,20 @@ private:
   std::map<std::string, std::shared_ptr<GGFont>> m_fontMap;
   std::map<std::string, std::shared_ptr<ngf::FntFont>> m_fntFontMap;
   std::map<std::string, std::shared_ptr<SpriteSheet>> m_spriteSheetMap;
+  std::shared_ptr<ngf::Texture> m_placeholder;
+  size_t m_textureMemory{0};
+  size_t m_textureBudget{0};
+  int m_preferencesSubscription{0};
+  int m_frame{0};
+
+  std::set<std::string> m_pendingTextures;
+  std::vector<std::thread> m_workers;
+  std::mutex m_mutex;
+  std::condition_variable m_requestCondition;
+  std::condition_variable m_decodedCondition;
+  std::deque<std::string> m_requests;
+  std::vector<DecodedImage> m_decoded;
+  std::set<std::string> m_decoding;
+  bool m_stopping{false};
 };
-} // namespace ng
\ No newline at end of file
+} // namespace ng
@@ -10,7 +10,7 @@ class SpriteSheet {
 public:
   void setTextureManager(ResourceManager *pTextureManager) { m_pResourceManager = pTextureManager; }
   void load(const std::string &name);
-  [[nodiscard]] std::shared_ptr<ngf::Texture> getTexture() const { return m_pResourceManager->getTexture(m_textureName); }
+  [[nodiscard]] std::shared_ptr<ngf::Texture> getTexture() const { return m_pResourceManager->getLoadedTexture(m_textureName); }
   [[nodiscard]] std::string getTextureName() const { return m_textureName; }
   [[nodiscard]] bool hasRect(const std::string &name) const;
   [[nodiscard]] ngf::irect getRect(const std::string &name) const;
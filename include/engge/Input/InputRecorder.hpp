@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+#include <glm/vec2.hpp>
+#include <ngf/System/TimeSpan.h>
+#include "engge/Input/InputConstants.hpp"
+
+namespace ng {
+/// @brief Binary format of the input recordings, all the values are little-endian.
+/// @details The file starts with the magic, the version and the seed of the random number generator (int64),
+/// then each frame is written as:
+/// - elapsed time in seconds (float32)
+/// - mouse position in window pixels (int16, int16)
+/// - mouse buttons (uint8): bit 0 for the left button, bit 1 for the right button
+/// - number of key events (uint8) and for each one: type and meta keys (uint8), key code (int32)
+namespace InputRecording {
+constexpr char Magic[4] = {'E', 'G', 'I', 'R'};
+constexpr std::uint32_t Version = 1;
+constexpr std::uint8_t LeftButton = 1;
+constexpr std::uint8_t RightButton = 2;
+/// Set in the type of a key event when the key is released.
+constexpr std::uint8_t KeyUp = 0x80;
+}
+
+/// @brief Records the input sampled by the engine at each frame to replay it with a `ReplayInputSource`.
+class InputRecorder {
+public:
+  InputRecorder(const std::filesystem::path &path, long seed);
+  ~InputRecorder();
+
+  [[nodiscard]] bool isOpen() const { return m_os.is_open(); }
+
+  void keyDown(const Input &key);
+  void keyUp(const Input &key);
+  /// Writes a frame with the key events received since the previous frame.
+  void recordFrame(const ngf::TimeSpan &elapsed, glm::ivec2 mousePosition, bool isLeftDown, bool isRightDown);
+
+private:
+  struct KeyEvent {
+    std::uint8_t type{0};
+    std::int32_t code{0};
+  };
+
+private:
+  std::ofstream m_os;
+  std::vector<KeyEvent> m_keys;
+  std::size_t m_frames{0};
+};
+} // namespace ng
@@ -0,0 +1,26 @@
+#pragma once
+#include <glm/vec2.hpp>
+#include <ngf/System/Mouse.h>
+
+namespace ng {
+/// Source of the mouse state read by the engine and the UI, it can be replaced to play the game without a user.
+class InputSource {
+public:
+  virtual ~InputSource() = default;
+
+  /// Called once per frame before the engine is updated.
+  virtual void update() {}
+  /// Gets the mouse position in window pixels.
+  [[nodiscard]] virtual glm::ivec2 getMousePosition() const = 0;
+  [[nodiscard]] virtual bool isMouseButtonPressed(ngf::Mouse::Button button) const = 0;
+};
+
+/// Reads the state of the mouse.
+class MouseInputSource final : public InputSource {
+public:
+  [[nodiscard]] glm::ivec2 getMousePosition() const final { return ngf::Mouse::getPosition(); }
+  [[nodiscard]] bool isMouseButtonPressed(ngf::Mouse::Button button) const final {
+    return ngf::Mouse::isButtonPressed(button);
+  }
+};
+} // namespace ng
@@ -0,0 +1,51 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+#include <ngf/System/TimeSpan.h>
+#include "engge/Input/InputConstants.hpp"
+#include "engge/Input/InputSource.hpp"
+
+namespace ng {
+/// @brief Plays the frames of a recording made by an `InputRecorder`.
+/// @details Each call to `update` applies the key events of the next frame and changes the mouse state,
+/// the application has to update the engine with the recorded elapsed time to reproduce the run.
+class ReplayInputSource final : public InputSource {
+public:
+  explicit ReplayInputSource(const std::filesystem::path &path);
+
+  [[nodiscard]] bool isValid() const { return m_isValid; }
+  [[nodiscard]] long getSeed() const { return m_seed; }
+  [[nodiscard]] std::size_t getFrameCount() const { return m_frames.size(); }
+  /// Indicates whether the last frame has been played.
+  [[nodiscard]] bool isFinished() const { return m_index >= m_frames.size(); }
+  /// Gets the elapsed time of the current frame.
+  [[nodiscard]] ngf::TimeSpan getElapsed() const { return m_elapsed; }
+
+  void update() final;
+  [[nodiscard]] glm::ivec2 getMousePosition() const final { return m_mousePosition; }
+  [[nodiscard]] bool isMouseButtonPressed(ngf::Mouse::Button button) const final;
+
+private:
+  struct KeyEvent {
+    bool isDown{true};
+    Input key{InputConstants::NONE};
+  };
+
+  struct Frame {
+    float elapsed{0};
+    glm::ivec2 mousePosition{0, 0};
+    std::uint8_t buttons{0};
+    std::vector<KeyEvent> keys;
+  };
+
+private:
+  bool m_isValid{false};
+  long m_seed{0};
+  std::vector<Frame> m_frames;
+  std::size_t m_index{0};
+  ngf::TimeSpan m_elapsed;
+  glm::ivec2 m_mousePosition{0, 0};
+  std::uint8_t m_buttons{0};
+};
+} // namespace ng
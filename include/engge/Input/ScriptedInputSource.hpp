@@ -0,0 +1,43 @@
+#pragma once
+#include <filesystem>
+#include <vector>
+#include "engge/Input/InputConstants.hpp"
+#include "engge/Input/InputSource.hpp"
+
+namespace ng {
+/// @brief Plays the input events listed in a text file, one event per line.
+/// @details Each line starts with the frame of the event followed by the command and its arguments:
+/// - `move x y`: moves the mouse to the window position (x,y)
+/// - `press left|right` and `release left|right`: presses or releases a mouse button
+/// - `keydown code` and `keyup code`: sends the key with the `InputConstants` value `code` to the engine
+/// The lines starting with '#' are ignored.
+class ScriptedInputSource final : public InputSource {
+public:
+  explicit ScriptedInputSource(const std::filesystem::path &path);
+
+  void update() final;
+  [[nodiscard]] glm::ivec2 getMousePosition() const final { return m_mousePosition; }
+  [[nodiscard]] bool isMouseButtonPressed(ngf::Mouse::Button button) const final;
+
+private:
+  enum class EventType { Move, Press, Release, KeyDown, KeyUp };
+
+  struct Event {
+    int frame{0};
+    EventType type{EventType::Move};
+    glm::ivec2 position{0, 0};
+    ngf::Mouse::Button button{ngf::Mouse::Button::Left};
+    InputConstants key{InputConstants::NONE};
+  };
+
+  void apply(const Event &event);
+
+private:
+  std::vector<Event> m_events;
+  std::size_t m_index{0};
+  int m_frame{0};
+  glm::ivec2 m_mousePosition{0, 0};
+  bool m_isLeftPressed{false};
+  bool m_isRightPressed{false};
+};
+} // namespace ng
@@ -2,13 +2,15 @@
 #include <ios>
 #include <vector>
 #include "GGPackStream.hpp"
+#include "engge/Engine/EntryView.hpp"
 
 class GGPackBufferStream : public GGPackStream {
 public:
   GGPackBufferStream() = default;
   explicit GGPackBufferStream(std::vector<char> input);
+  explicit GGPackBufferStream(ng::EntryView input);
 
-  void setBuffer(const std::vector<char> &input);
+  void setBuffer(ng::EntryView input);
   void read(char *data, size_t size) override;
   void seek(int pos) override;
   [[nodiscard]] int getLength() const override;
@@ -18,6 +20,6 @@ public:
   GGPackBufferStream &ignore(std::streamsize n = 1, int delim = EOF);
 
 private:
-  std::vector<char> m_input;
+  ng::EntryView m_input;
   int m_offset{0};
 };
@@ -1,14 +1,30 @@
 #pragma once
 #include <string>
 #include <filesystem>
+#include <optional>
 #include <vector>
 #include <ngf/IO/GGPackValue.h>
 
 namespace ng {
+/// @brief Information displayed for a savegame slot.
+struct SavegameInfo {
+  int32_t savetime{0};
+  double gameTime{0};
+  bool easyMode{false};
+};
+
 class SavegameManager {
 public:
   static ngf::GGPackValue loadGame(const std::filesystem::path &path);
   static void saveGame(const std::filesystem::path &path, const ngf::GGPackValue& hash);
   static int32_t computeHash(const std::vector<char> &data, int32_t size);
+
+  /// @brief Gets the information of a savegame from its content.
+  static SavegameInfo getInfo(const ngf::GGPackValue &hash);
+  /// @brief Loads the information of a savegame from its sidecar file (.meta), without decrypting the savegame.
+  /// \return the information or nothing if the sidecar file is missing, invalid or older than the savegame.
+  static std::optional<SavegameInfo> loadInfo(const std::filesystem::path &path);
+  /// @brief Saves the information of a savegame to its sidecar file (.meta).
+  static void saveInfo(const std::filesystem::path &path, const SavegameInfo &info);
 };
 }
\ No newline at end of file
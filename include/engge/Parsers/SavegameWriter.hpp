@@ -0,0 +1,61 @@
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <ngf/IO/GGPackValue.h>
+#include <engge/System/NonCopyable.hpp>
+
+namespace ngf {
+class Image;
+}
+
+namespace ng {
+/// @brief Writes the savegames in background.
+/// The snapshot of the game is taken on the main thread, then the serialization, the encryption
+/// and the writing of the savegame and its screenshot are done by a worker thread.
+class SavegameWriter : public NonCopyable {
+public:
+  using Callback = std::function<void()>;
+
+  SavegameWriter();
+  ~SavegameWriter();
+
+  /// @brief Requests the savegame to be written.
+  /// \param onSaved: function called from update() once the savegame has been written.
+  void save(std::filesystem::path path,
+            ngf::GGPackValue hash,
+            std::unique_ptr<ngf::Image> screenshot,
+            Callback onSaved);
+
+  /// @brief Calls the functions of the savegames which have been written, has to be called from the main thread.
+  void update();
+  /// @brief Waits until all the requested savegames have been written.
+  void wait();
+
+private:
+  struct Job {
+    std::filesystem::path path;
+    ngf::GGPackValue hash;
+    std::unique_ptr<ngf::Image> screenshot;
+    Callback onSaved;
+  };
+
+  static void write(Job &job);
+  void writeLoop();
+
+private:
+  std::thread m_worker;
+  std::mutex m_mutex;
+  std::condition_variable m_jobCondition;
+  std::condition_variable m_doneCondition;
+  std::deque<Job> m_jobs;
+  std::vector<Callback> m_done;
+  bool m_writing{false};
+  bool m_stopping{false};
+};
+}
@@ -0,0 +1,73 @@
+#pragma once
+#include <utility>
+#include <squirrel.h>
+#include "engge/Scripting/ScriptEngine.hpp"
+#include "engge/System/NonCopyable.hpp"
+
+namespace ng {
+/// @brief Handle to a function called by the engine on a script table, like `actorArrived` on an actor.
+/// @details The function is looked up in the table without its delegates, like `ScriptEngine::rawCall`.
+/// The closure is kept until the handle is used with another table or until a slot of the table
+/// is added, written or removed, so the hot paths don't hash the name on each call.
+class ScriptCallback : public NonCopyable {
+public:
+  explicit ScriptCallback(const char *name);
+  ~ScriptCallback();
+
+  [[nodiscard]] const char *getName() const { return m_name; }
+
+  /// Indicates whether the function exists in the table of `pThis`.
+  template<typename TThis>
+  bool exists(TThis pThis);
+
+  /// Calls the function with `pThis` as environment.
+  template<typename TThis, typename... T>
+  bool call(TThis pThis, T... args);
+
+private:
+  bool resolve(HSQUIRRELVM v, SQInteger index);
+  void release();
+
+private:
+  const char *m_name{nullptr};
+  HSQOBJECT m_table{};
+  HSQOBJECT m_closure{};
+  SQUnsignedInteger m_version{0};
+};
+
+template<typename TThis>
+bool ScriptCallback::exists(TThis pThis) {
+  auto v = ScriptEngine::getVm();
+  auto top = sq_gettop(v);
+  ScriptEngine::push(v, pThis);
+  auto found = resolve(v, -1);
+  sq_settop(v, top);
+  return found;
+}
+
+template<typename TThis, typename... T>
+bool ScriptCallback::call(TThis pThis, T... args) {
+  constexpr std::size_t n = sizeof...(T);
+  auto v = ScriptEngine::getVm();
+  auto top = sq_gettop(v);
+  ScriptEngine::push(v, pThis);
+  if (!resolve(v, -1)) {
+    sq_settop(v, top);
+    trace("can't find {} function", m_name);
+    return false;
+  }
+  sq_pushobject(v, m_closure);
+  sq_push(v, -2);
+  if constexpr (n > 0) {
+    ScriptEngine::push(v, std::forward<T>(args)...);
+  }
+  if (SQ_FAILED(sq_call(v, n + 1, SQFalse, SQTrue))) {
+    sqstd_printcallstack(v);
+    sq_settop(v, top);
+    error("function {} call failed", m_name);
+    return false;
+  }
+  sq_settop(v, top);
+  return true;
+}
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include <cassert>
 #include <functional>
+#include <memory>
 #include <string>
 #include <squirrel.h>
 #include "../../../extlibs/squirrel/squirrel/sqobject.h"
@@ -16,6 +17,8 @@ public:
   virtual void registerPack() const = 0;
   virtual ~Pack() = default;
 };
+class ScriptCache;
+
 class ScriptEngine {
 public:
   using ErrorCallback = std::function<void(
@@ -30,6 +33,7 @@ public:
   static Engine &getEngine();
 
   static HSQUIRRELVM getVm() { return m_vm; }
+  static HSQOBJECT getRootTable();
 
   static SQObjectPtr toSquirrel(const std::string &value);
 
@@ -84,6 +88,8 @@ public:
 
   template <typename TThis, typename T>
   static bool rawGet(TThis pThis, const char *name, T &result);
+  /// Gets a counter incremented each time a slot of the table is added, written or removed.
+  static SQUnsignedInteger getVersion(HSQOBJECT table);
 
   template <typename... T> static bool rawCall(const char *name, T... args);
   static bool rawCall(const char *name);
@@ -117,6 +123,7 @@ private:
 private:
   inline static HSQUIRRELVM m_vm{};
   std::vector<std::unique_ptr<Pack>> m_packs;
+  std::unique_ptr<ScriptCache> m_pCache;
   inline static std::vector<PrintCallback> m_errorCallbacks;
   inline static std::vector<PrintCallback> m_printCallbacks;
 
@@ -0,0 +1,108 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <spdlog/common.h>
+
+namespace ng {
+/// @brief A formatted log message waiting to be written.
+struct LogRecord {
+  static constexpr std::size_t MaxSize = 1024;
+
+  spdlog::level::level_enum level{spdlog::level::trace};
+  /// Time of the call, the record is written later by another thread.
+  spdlog::log_clock::time_point time;
+  std::size_t size{0};
+  char text[MaxSize]{};
+};
+
+/// @brief Bounded lock-free queue of log records, written by any thread and read by the flush thread.
+/// @details The records are allocated once, a producer reserves a record, formats its message in place
+/// and publishes it. When the queue is full the message is dropped instead of blocking the producer.
+class LogQueue {
+private:
+  struct Cell;
+
+public:
+  static constexpr std::size_t Capacity = 4096;
+
+  class Reservation {
+  public:
+    [[nodiscard]] explicit operator bool() const { return m_pCell != nullptr; }
+    LogRecord *operator->() const { return &m_pCell->record; }
+
+  private:
+    friend class LogQueue;
+    Cell *m_pCell{nullptr};
+    std::size_t m_position{0};
+  };
+
+  LogQueue() : m_cells(std::make_unique<Cell[]>(Capacity)) {
+    for (std::size_t i = 0; i < Capacity; ++i) {
+      m_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  /// Reserves a record, returns an empty reservation if the queue is full.
+  Reservation reserve() {
+    Reservation reservation;
+    auto position = m_enqueuePosition.load(std::memory_order_relaxed);
+    while (true) {
+      auto &cell = m_cells[position & Mask];
+      auto sequence = cell.sequence.load(std::memory_order_acquire);
+      auto diff = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(position);
+      if (diff == 0) {
+        if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+          reservation.m_pCell = &cell;
+          reservation.m_position = position;
+          return reservation;
+        }
+      } else if (diff < 0) {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+        return reservation;
+      } else {
+        position = m_enqueuePosition.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /// Makes a reserved record visible to the consumer.
+  void publish(const Reservation &reservation) {
+    reservation.m_pCell->sequence.store(reservation.m_position + 1, std::memory_order_release);
+  }
+
+  /// Calls `f` with each published record, must be called by a single thread.
+  /// \return the number of records consumed.
+  template<typename F>
+  std::size_t consume(F f) {
+    std::size_t count = 0;
+    while (true) {
+      auto &cell = m_cells[m_dequeuePosition & Mask];
+      auto sequence = cell.sequence.load(std::memory_order_acquire);
+      if (sequence != m_dequeuePosition + 1)
+        return count;
+      f(cell.record);
+      cell.sequence.store(m_dequeuePosition + Capacity, std::memory_order_release);
+      ++m_dequeuePosition;
+      ++count;
+    }
+  }
+
+  /// Returns the number of messages dropped since the last call.
+  std::size_t takeDropped() { return m_dropped.exchange(0, std::memory_order_relaxed); }
+
+private:
+  static constexpr std::size_t Mask = Capacity - 1;
+  static_assert((Capacity & Mask) == 0, "Capacity must be a power of 2");
+
+  struct Cell {
+    std::atomic<std::size_t> sequence{0};
+    LogRecord record;
+  };
+
+  std::unique_ptr<Cell[]> m_cells;
+  alignas(64) std::atomic<std::size_t> m_enqueuePosition{0};
+  alignas(64) std::size_t m_dequeuePosition{0};
+  std::atomic<std::size_t> m_dropped{0};
+};
+}
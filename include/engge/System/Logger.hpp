@@ -1,19 +1,35 @@
 #pragma once
+#include <algorithm>
+#include <atomic>
 #include <memory>
+#include <thread>
 #include <spdlog/spdlog.h>
 #include "Locator.hpp"
+#include "LogQueue.hpp"
 #undef Yield
 
+/// Messages below this level are removed at compile time, their arguments are never formatted.
+#ifndef ENGGE_LOG_ACTIVE_LEVEL
+#ifdef NDEBUG
+#define ENGGE_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_INFO
+#else
+#define ENGGE_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_TRACE
+#endif
+#endif
+
 namespace ng {
 template<typename T>
 using basic_string_view_t = fmt::basic_string_view<T>;
 
 using string_view_t = spdlog::string_view_t;
 
+/// @brief Asynchronous logger.
+/// @details The messages are formatted by the calling thread into a preallocated record of a lock-free
+/// queue, a background thread writes them to the console and to log.txt.
 class Logger {
 public:
   Logger();
-  virtual ~Logger() = default;
+  virtual ~Logger();
 
   template<typename... Args>
   void trace(string_view_t message, const Args &... args);
@@ -26,57 +42,104 @@ public:
   template<typename... Args>
   void critical(string_view_t message, const Args &... args);
 
+  static constexpr bool isActive(spdlog::level::level_enum level) {
+    return static_cast<int>(level) >= ENGGE_LOG_ACTIVE_LEVEL;
+  }
+
+private:
+  template<spdlog::level::level_enum Level, typename... Args>
+  void log(string_view_t message, const Args &... args);
+  void run();
+  std::size_t write();
+  void write(const LogRecord &record);
+
 private:
   std::shared_ptr<spdlog::logger> m_out;
+  LogQueue m_queue;
+  std::atomic<bool> m_done{false};
+  std::thread m_thread;
 };
 
+template<spdlog::level::level_enum Level, typename... Args>
+void Logger::log(string_view_t message, const Args &... args) {
+  if constexpr (isActive(Level)) {
+    auto record = m_queue.reserve();
+    if (!record)
+      return;
+
+    record->level = Level;
+    record->time = spdlog::log_clock::now();
+    try {
+      auto result = fmt::format_to_n(record->text, LogRecord::MaxSize, message, args...);
+      record->size = std::min(result.size, LogRecord::MaxSize);
+      if (result.size > LogRecord::MaxSize) {
+        std::fill_n(record->text + LogRecord::MaxSize - 3, 3, '.');
+      }
+    } catch (const fmt::format_error &e) {
+      auto result = fmt::format_to_n(record->text, LogRecord::MaxSize, "failed to format '{}': {}", message, e.what());
+      record->size = std::min(result.size, LogRecord::MaxSize);
+    }
+    m_queue.publish(record);
+  }
+}
+
 template<typename... Args>
 void Logger::trace(string_view_t message, const Args &... args) {
-  m_out->trace(message, args...);
+  log<spdlog::level::trace>(message, args...);
 }
 
 template<typename... Args>
 void Logger::info(string_view_t message, const Args &... args) {
-  m_out->info(message, args...);
+  log<spdlog::level::info>(message, args...);
 }
 
 template<typename... Args>
 void Logger::warn(string_view_t message, const Args &... args) {
-  m_out->warn(message, args...);
+  log<spdlog::level::warn>(message, args...);
 }
 
 template<typename... Args>
 void Logger::error(string_view_t message, const Args &... args) {
-  m_out->error(message, args...);
+  log<spdlog::level::err>(message, args...);
 }
 
 template<typename... Args>
 void Logger::critical(string_view_t message, const Args &... args) {
-  m_out->critical(message, args...);
+  log<spdlog::level::critical>(message, args...);
 }
 
 template<typename... Args>
 static void trace(string_view_t message, const Args &... args) {
-  Locator<Logger>::get().trace(message, args...);
+  if constexpr (Logger::isActive(spdlog::level::trace)) {
+    Locator<Logger>::get().trace(message, args...);
+  }
 }
 
 template<typename... Args>
 static void info(string_view_t message, const Args &... args) {
-  Locator<Logger>::get().info(message, args...);
+  if constexpr (Logger::isActive(spdlog::level::info)) {
+    Locator<Logger>::get().info(message, args...);
+  }
 }
 
 template<typename... Args>
 static void warn(string_view_t message, const Args &... args) {
-  Locator<Logger>::get().warn(message, args...);
+  if constexpr (Logger::isActive(spdlog::level::warn)) {
+    Locator<Logger>::get().warn(message, args...);
+  }
 }
 
 template<typename... Args>
 static void error(string_view_t message, const Args &... args) {
-  Locator<Logger>::get().error(message, args...);
+  if constexpr (Logger::isActive(spdlog::level::err)) {
+    Locator<Logger>::get().error(message, args...);
+  }
 }
 
 template<typename... Args>
 static void critical(string_view_t message, const Args &... args) {
-  Locator<Logger>::get().critical(message, args...);
+  if constexpr (Logger::isActive(spdlog::level::critical)) {
+    Locator<Logger>::get().critical(message, args...);
+  }
 }
 } // namespace ng
@@ -2,10 +2,12 @@
 #include <Engine/AchievementManager.hpp>
 #include "engge/Audio/SoundManager.hpp"
 #include "engge/Input/CommandManager.hpp"
+#include "engge/Input/InputSource.hpp"
 #include "engge/Engine/EngineSettings.hpp"
 #include "engge/Engine/EntityManager.hpp"
 #include "engge/Engine/Preferences.hpp"
 #include "engge/Engine/TextDatabase.hpp"
+#include "engge/Engine/WaitQueue.hpp"
 #include "Locator.hpp"
 #include "Logger.hpp"
 #include "engge/Util/RandomNumberGenerator.hpp"
@@ -18,10 +20,12 @@ public:
     ng::info("Init services");
     ng::Locator<ng::RandomNumberGenerator>::create();
     ng::Locator<ng::CommandManager>::create();
+    ng::Locator<ng::InputSource>::set(std::make_shared<ng::MouseInputSource>());
     ng::Locator<ng::AchievementManager>::create();
     ng::Locator<ng::Preferences>::create();
     ng::Locator<ng::EngineSettings>::create().loadPacks();
     ng::Locator<ng::EntityManager>::create();
+    ng::Locator<ng::WaitQueue>::create();
     ng::Locator<ng::SoundManager>::create();
     ng::Locator<ng::TextDatabase>::create();
     ng::Locator<ng::ResourceManager>::create();
@@ -6,11 +6,16 @@ public:
   RandomNumberGenerator();
   void setSeed(long seed);
   [[nodiscard]] long getSeed() const;
+  /// Sets a seed from the current time, unless the seed is fixed.
+  void setTimeSeed();
+  /// When the seed is fixed, only explicit seeds are used, so an input recording can be replayed.
+  void setFixedSeed(bool fixed) { m_isSeedFixed = fixed; }
 
   long generateLong(long min, long max);
   float generateFloat(float min, float max);
 
 private:
   long m_seed{0};
+  bool m_isSeedFixed{false};
 };
 }
\ No newline at end of file
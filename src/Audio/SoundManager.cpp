@@ -2,6 +2,7 @@
 #include <ngf/Audio/AudioSystem.h>
 #include <engge/Engine/Engine.hpp>
 #include <engge/Engine/EngineSettings.hpp>
+#include <engge/Engine/WaitQueue.hpp>
 #include <engge/Entities/Entity.hpp>
 #include <engge/EnggeApplication.hpp>
 #include <engge/System/Locator.hpp>
@@ -53,6 +54,8 @@ std::shared_ptr<SoundId> SoundManager::play(std::shared_ptr<SoundDefinition> sou
                                             int loopTimes,
                                             const ngf::TimeSpan &fadeInTime,
                                             int id) {
+  if (!m_isAudioEnabled)
+    return nullptr;
   soundDefinition->load();
   auto
       sound = m_pEngine->getApplication()->getAudioSystem().playSound(soundDefinition->m_buffer, loopTimes, fadeInTime);
@@ -72,16 +75,20 @@ std::shared_ptr<SoundId> SoundManager::play(std::shared_ptr<SoundDefinition> sou
     break;
   }
   trace("[{}] loop {} {} {}", index, loopTimes, sCategory, soundDefinition->getPath());
+  signal(m_soundIds[index].get());
   m_soundIds[index] = soundId;
   return soundId;
 }
 
 void SoundManager::stopAllSounds() {
   trace("stopAllSounds");
-  for (auto channel : m_pEngine->getApplication()->getAudioSystem()) {
-    channel.stop();
+  if (m_isAudioEnabled) {
+    for (auto channel : m_pEngine->getApplication()->getAudioSystem()) {
+      channel.stop();
+    }
   }
   for (auto &soundId : m_soundIds) {
+    signal(soundId.get());
     soundId.reset();
   }
 }
@@ -92,6 +99,7 @@ void SoundManager::stopSound(std::shared_ptr<SoundDefinition> soundDef) {
     auto sound = m_soundIds[i];
     if (sound && soundDef.get()->getId() == sound->getId()) {
       sound->getSoundHandle()->get().stop();
+      signal(sound.get());
       m_soundIds[i].reset();
     }
   }
@@ -113,12 +121,19 @@ void SoundManager::update(const ngf::TimeSpan &elapsed) {
     if (soundId) {
       soundId->update(elapsed);
       if (soundId->getSoundHandle()->get().getStatus() == ngf::AudioChannel::Status::Stopped) {
+        signal(soundId.get());
         soundId.reset();
       }
     }
   }
 }
 
+void SoundManager::signal(const SoundId *pSoundId) {
+  if (!pSoundId)
+    return;
+  Locator<WaitQueue>::get().signal(WaitEvent::Sound, pSoundId);
+}
+
 void SoundManager::pauseAllSounds() {
   for (auto soundId : m_soundIds) {
     if (soundId) {
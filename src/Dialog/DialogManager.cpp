@@ -1,9 +1,15 @@
 #include <regex>
-#include <ngf/System/Mouse.h>
+#include <engge/Input/InputSource.hpp>
 #include <ngf/Graphics/Text.h>
 #include <engge/Dialog/DialogManager.hpp>
 #include <engge/Engine/Engine.hpp>
+#include <engge/Engine/EngineSettings.hpp>
 #include <engge/Engine/Preferences.hpp>
+#include <engge/Entities/Actor.hpp>
+#include <engge/Entities/Object.hpp>
+#include <engge/Room/Room.hpp>
+#include <engge/System/Locator.hpp>
+#include <engge/System/Logger.hpp>
 #include <engge/Scripting/ScriptEngine.hpp>
 #include <engge/Graphics/Screen.hpp>
 #include <engge/Graphics/Text.hpp>
@@ -26,7 +32,7 @@ void DialogManager::setEngine(Engine *pEngine) {
 }
 
 void DialogManager::start(const std::string &actor, const std::string &name, const std::string &node) {
-  m_pPlayer->start(actor, name, node);
+  m_pPlayer->start(actor, name, getCompilationUnit(name), node);
 
   auto oldState = m_state;
   m_state = m_pPlayer->getState();
@@ -40,6 +46,61 @@ void DialogManager::start(const std::string &actor, const std::string &name, con
   }
 }
 
+std::shared_ptr<const Ast::CompilationUnit> DialogManager::getCompilationUnit(const std::string &name) {
+  auto it = m_compilationUnitMap.find(name);
+  if (it != m_compilationUnitMap.end()) {
+    m_compilationUnits.splice(m_compilationUnits.begin(), m_compilationUnits, it->second);
+    return it->second->second;
+  }
+
+  std::string path;
+  path.append(name).append(".byack");
+
+  YackTokenReader reader;
+  reader.load(path);
+  YackParser parser(reader);
+  std::shared_ptr<const Ast::CompilationUnit> pCompilationUnit = parser.parse();
+
+  // a dialog being played keeps its compilation unit alive after its eviction
+  if (m_compilationUnits.size() >= MaxCompilationUnits) {
+    m_compilationUnitMap.erase(m_compilationUnits.back().first);
+    m_compilationUnits.pop_back();
+  }
+  m_compilationUnits.emplace_front(name, pCompilationUnit);
+  m_compilationUnitMap[name] = m_compilationUnits.begin();
+  return pCompilationUnit;
+}
+
+void DialogManager::warm(const std::string &name) {
+  if (m_compilationUnitMap.find(name) != m_compilationUnitMap.end())
+    return;
+  if (!Locator<EngineSettings>::get().hasEntry(name + ".byack"))
+    return;
+  trace("Warm dialog {}", name);
+  try {
+    getCompilationUnit(name);
+  } catch (const std::exception &e) {
+    // the player may never open this dialog, it will fail again if it is started
+    warn("Failed to warm dialog {}: {}", name, e.what());
+  }
+}
+
+void DialogManager::warm(const Room &room) {
+  // the dialogs of the previous room are not needed anymore
+  m_dialogsToWarm.clear();
+  const char *dialog = nullptr;
+  for (const auto &pActor : m_pEngine->getActors()) {
+    if (!pActor || pActor->getRoom() != &room)
+      continue;
+    if (ScriptEngine::rawGet(pActor.get(), "dialog", dialog) && dialog)
+      m_dialogsToWarm.emplace_back(dialog);
+  }
+  for (const auto &pObject : room.getObjects()) {
+    if (ScriptEngine::rawGet(pObject.get(), "dialog", dialog) && dialog)
+      m_dialogsToWarm.emplace_back(dialog);
+  }
+}
+
 void DialogManager::draw(ngf::RenderTarget &target, ngf::RenderStates) const {
   if (m_state != DialogManagerState::WaitingForChoice)
     return;
@@ -82,6 +143,11 @@ void DialogManager::draw(ngf::RenderTarget &target, ngf::RenderStates) const {
 }
 
 void DialogManager::update(const ngf::TimeSpan &elapsed) {
+  for (size_t i = 0; i < MaxWarmedDialogsPerUpdate && !m_dialogsToWarm.empty(); ++i) {
+    warm(m_dialogsToWarm.front());
+    m_dialogsToWarm.pop_front();
+  }
+
   m_pPlayer->update();
   auto oldState = m_state;
   m_state = m_pPlayer->getState();
@@ -160,7 +226,7 @@ void DialogManager::updateChoices(const ngf::TimeSpan &elapsed) {
     dialog++;
   }
 
-  if (!ngf::Mouse::isButtonPressed(ngf::Mouse::Button::Left))
+  if (!Locator<InputSource>::get().isMouseButtonPressed(ngf::Mouse::Button::Left))
     return;
 
   y = DialogTop;
@@ -72,17 +72,14 @@ void ConditionStateVisitor::setState(int32_t line, DialogConditionMode mode) {
 DialogPlayer::DialogPlayer(DialogScriptAbstract &script) : _script(script) {}
 DialogPlayer::~DialogPlayer() = default;
 
-void DialogPlayer::start(const std::string &actor, const std::string &name, const std::string &node) {
+void DialogPlayer::start(const std::string &actor,
+                         const std::string &name,
+                         std::shared_ptr<const Ast::CompilationUnit> compilationUnit,
+                         const std::string &node) {
   resetState();
   m_actor = actor;
   m_dialogName = name;
-  std::string path;
-  path.append(name).append(".byack");
-
-  YackTokenReader reader;
-  reader.load(path);
-  YackParser parser(reader);
-  m_pCompilationUnit = parser.parse();
+  m_pCompilationUnit = std::move(compilationUnit);
   selectLabel(node);
 }
 
@@ -251,7 +248,7 @@ bool DialogPlayer::gotoNextLabel() {
   return true;
 }
 
-void DialogPlayer::run(Ast::Statement *pStatement) {
+void DialogPlayer::run(const Ast::Statement *pStatement) {
   if (!acceptConditions(pStatement))
     return;
   ExpressionVisitor visitor(*this);
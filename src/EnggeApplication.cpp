@@ -1,6 +1,12 @@
+#include <algorithm>
+#include <numeric>
 #include "engge/EnggeApplication.hpp"
 #include "engge/Input/InputMappings.hpp"
+#include "engge/Input/InputRecorder.hpp"
+#include "engge/Input/ReplayInputSource.hpp"
+#include "engge/Input/ScriptedInputSource.hpp"
 #include "Engine/DebugFeatures.hpp"
+#include "System/FrameProfiler.hpp"
 #include <ngf/Graphics/Colors.h>
 #include "engge/Engine/EngineCommands.hpp"
 
@@ -53,10 +59,43 @@ ng::MetaKeys toMetaKeys(const ngf::KeyModifiers &modifiers) {
 }
 
 namespace ng {
+void EnggeApplication::setHeadless(const HeadlessOptions &options) {
+  m_isHeadless = true;
+  m_headlessOptions = options;
+  m_headlessOptions.frames = std::max(1, options.frames);
+  m_headlessOptions.frameRate = std::max(1, options.frameRate);
+}
+
 void EnggeApplication::onInit() {
   m_window.init({"Engge", {ng::Screen::Width, ng::Screen::Height}});
   ng::Services::init();
 
+  if (m_isHeadless) {
+    ng::info("Headless mode: {} frames at {} fps", m_headlessOptions.frames, m_headlessOptions.frameRate);
+    ng::Locator<ng::SoundManager>::get().setAudioEnabled(false);
+    if (!m_headlessOptions.inputPath.empty()) {
+      ng::Locator<ng::InputSource>::set(std::make_shared<ng::ScriptedInputSource>(m_headlessOptions.inputPath));
+    }
+    m_updateTimes.reserve(m_headlessOptions.frames);
+  }
+
+  // the time seeds are ignored, so the scripts get the same random numbers when the input is replayed
+  auto &randomNumberGenerator = ng::Locator<ng::RandomNumberGenerator>::get();
+  if (!m_inputReplayPath.empty()) {
+    m_inputReplay = std::make_shared<ng::ReplayInputSource>(m_inputReplayPath);
+    if (!m_inputReplay->isValid()) {
+      throw std::runtime_error("Failed to load input recording " + m_inputReplayPath.string());
+    }
+    randomNumberGenerator.setSeed(m_inputReplay->getSeed());
+    randomNumberGenerator.setFixedSeed(true);
+    ng::Locator<ng::InputSource>::set(m_inputReplay);
+    m_updateTimes.reserve(m_inputReplay->getFrameCount());
+  }
+  if (!m_inputRecordingPath.empty()) {
+    randomNumberGenerator.setFixedSeed(true);
+    m_inputRecorder = std::make_unique<ng::InputRecorder>(m_inputRecordingPath, randomNumberGenerator.getSeed());
+  }
+
   // read achievements if any
   auto achievementsPath = ng::Locator<ng::EngineSettings>::get().getPath();
   achievementsPath.append("save.dat");
@@ -74,6 +113,7 @@ void EnggeApplication::onInit() {
   auto &scriptEngine = ng::Locator<ng::ScriptEngine>::create();
   m_engine = &ng::Locator<ng::Engine>::create();
   m_engine->setApplication(this);
+  m_engine->setInputRecorder(m_inputRecorder.get());
   scriptEngine.setEngine(*m_engine);
   m_debugTools = std::make_unique<ng::DebugTools>(*m_engine);
 
@@ -122,7 +162,7 @@ void EnggeApplication::onEvent(ngf::Event &event) {
   case ngf::EventType::KeyReleased: {
     auto key = toKey(event.key.scancode);
     auto metaKey = toMetaKeys(event.key.modifiers);
-    if (key != ng::InputConstants::NONE) {
+    if (key != ng::InputConstants::NONE && !m_inputReplay) {
       m_engine->keyUp({metaKey, key});
     }
     if (event.key.scancode == ngf::Scancode::Space) {
@@ -133,7 +173,7 @@ void EnggeApplication::onEvent(ngf::Event &event) {
   case ngf::EventType::KeyPressed: {
     auto key = toKey(event.key.scancode);
     auto metaKey = toMetaKeys(event.key.modifiers);
-    if (key != ng::InputConstants::NONE) {
+    if (key != ng::InputConstants::NONE && !m_inputReplay) {
       m_engine->keyDown({metaKey, key});
     }
     if (event.key.scancode == ngf::Scancode::Space) {
@@ -146,6 +186,11 @@ void EnggeApplication::onEvent(ngf::Event &event) {
 }
 
 void EnggeApplication::onRender(ngf::RenderTarget &target) {
+  if (m_isHeadless) {
+    Application::onRender(target);
+    return;
+  }
+  ENGGE_PROFILE_SCOPE("render");
   ngf::StopWatch clock;
   target.clear();
   if (m_engine)
@@ -155,17 +200,86 @@ void EnggeApplication::onRender(ngf::RenderTarget &target) {
 }
 
 void EnggeApplication::onImGuiRender() {
+  if (m_isHeadless)
+    return;
+  ENGGE_PROFILE_SCOPE("imgui");
   m_debugTools->render();
 }
 
 void EnggeApplication::onUpdate(const ngf::TimeSpan &elapsed) {
+  ENGGE_PROFILE_FRAME();
+  if (!m_engine)
+    return;
   if (!m_init) {
     m_engine->run();
     m_init = true;
+    m_runClock.restart();
   }
+  Locator<InputSource>::get().update();
+
+  // the time step is fixed in headless mode and recorded in a replay, so a run doesn't depend on the machine
+  if (m_isHeadless || m_inputReplay) {
+    auto frameElapsed = m_inputReplay ? m_inputReplay->getElapsed()
+                                      : ngf::TimeSpan::seconds(1.f / m_headlessOptions.frameRate);
+    ngf::StopWatch clock;
+    m_engine->update(frameElapsed);
+    ng::DebugFeatures::updateTime = clock.getElapsedTime();
+
+    m_updateTimes.push_back(ng::DebugFeatures::updateTime);
+    m_simulatedTime += frameElapsed.getTotalSeconds();
+    auto isDone = m_inputReplay ? m_inputReplay->isFinished()
+                                : static_cast<int>(m_updateTimes.size()) == m_headlessOptions.frames;
+    if (isDone) {
+      logUpdateStats();
+      m_engine->quit();
+    }
+    return;
+  }
+
+  auto updateRate = m_engine->getPreferences().getUserPreference(PreferenceNames::EnggeUpdateRate,
+                                                                 PreferenceDefaultValues::EnggeUpdateRate);
   ngf::StopWatch clock;
-  m_engine->update(elapsed);
+  if (updateRate <= 0) {
+    m_engine->setRenderInterpolation(1.f);
+    m_engine->update(elapsed);
+    ng::DebugFeatures::updateTime = clock.getElapsedTime();
+    ng::DebugFeatures::updateSteps = 1;
+    return;
+  }
+
+  // the simulation advances with fixed steps, the time left is used to interpolate the entities when drawing
+  // a long frame (loading, debugger...) is not caught up entirely, the game slows down instead of freezing
+  const auto step = 1.f / static_cast<float>(updateRate);
+  m_accumulator += std::min(elapsed.getTotalSeconds(), MaxFrameTime);
+  int steps = 0;
+  while (m_accumulator >= step && steps < MaxStepsPerFrame) {
+    m_engine->update(ngf::TimeSpan::seconds(step));
+    m_accumulator -= step;
+    steps++;
+  }
+  if (steps == MaxStepsPerFrame) {
+    m_accumulator = std::min(m_accumulator, step);
+  }
+  m_engine->setRenderInterpolation(m_accumulator / step);
   ng::DebugFeatures::updateTime = clock.getElapsedTime();
+  ng::DebugFeatures::updateSteps = steps;
+}
+
+void EnggeApplication::logUpdateStats() {
+  auto wallTime = m_runClock.getElapsedTime();
+  std::vector<float> times(m_updateTimes.size());
+  std::transform(m_updateTimes.cbegin(), m_updateTimes.cend(), times.begin(),
+                 [](const auto &time) { return time.getTotalSeconds() * 1000.f; });
+  std::sort(times.begin(), times.end());
+  auto percentile = [&times](float p) {
+    auto index = static_cast<std::size_t>(p * (times.size() - 1));
+    return times[index];
+  };
+  auto total = std::accumulate(times.cbegin(), times.cend(), 0.f);
+  ng::info("{} run: {} frames, simulated {:.2f}s in {:.2f}s",
+           m_inputReplay ? "Replay" : "Headless", times.size(), m_simulatedTime, wallTime.getTotalSeconds());
+  ng::info("Update (ms): mean {:.3f} min {:.3f} max {:.3f} p50 {:.3f} p95 {:.3f} p99 {:.3f}",
+           total / times.size(), times.front(), times.back(), percentile(0.5f), percentile(0.95f), percentile(0.99f));
 }
 
 void EnggeApplication::onQuit() {
@@ -1,7 +1,7 @@
 #define _USE_MATH_DEFINES
 #include <cmath>
 #include <ngf/Graphics/Sprite.h>
-#include <ngf/System/Mouse.h>
+#include "engge/Input/InputSource.hpp"
 #include "engge/System/Locator.hpp"
 #include "engge/Graphics/SpriteSheet.hpp"
 #include "engge/Engine/ActorIcons.hpp"
@@ -54,14 +54,14 @@ void ActorIcons::update(const ngf::TimeSpan &elapsed) {
     m_position = 1;
   }
 
-  if (m_isInside && !m_isMouseButtonPressed && ngf::Mouse::isButtonPressed(ngf::Mouse::Button::Left)) {
+  if (m_isInside && !m_isMouseButtonPressed && Locator<InputSource>::get().isMouseButtonPressed(ngf::Mouse::Button::Left)) {
     m_isMouseButtonPressed = true;
     return;
   }
 
   auto isEnabled = ((m_mode & ActorSlotSelectableMode::On) == ActorSlotSelectableMode::On)
       && ((m_mode & ActorSlotSelectableMode::TemporaryUnselectable) != ActorSlotSelectableMode::TemporaryUnselectable);
-  if (m_isMouseButtonPressed && !ngf::Mouse::isButtonPressed(ngf::Mouse::Button::Left)) {
+  if (m_isMouseButtonPressed && !Locator<InputSource>::get().isMouseButtonPressed(ngf::Mouse::Button::Left)) {
     m_isMouseButtonPressed = false;
     iconRect =
         ngf::frect::fromPositionSize({Screen::Width - iconSize.x - rightMargin, topMargin + iconsMargin + iconSize.y},
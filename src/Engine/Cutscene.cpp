@@ -4,6 +4,7 @@
 #include <engge/System/Logger.hpp>
 #include <engge/Scripting/ScriptEngine.hpp>
 #include <engge/Engine/EntityManager.hpp>
+#include "Scripting/ScriptProfiler.hpp"
 
 namespace ng {
 Cutscene::Cutscene(Engine &engine,
@@ -28,6 +29,7 @@ Cutscene::Cutscene(Engine &engine,
 }
 
 Cutscene::~Cutscene() {
+  ScriptProfiler::remove(getThread());
   auto engineVm = ScriptEngine::getVm();
   sq_release(engineVm, &m_threadCutscene);
   sq_release(engineVm, &m_closureObj);
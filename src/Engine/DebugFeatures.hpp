@@ -8,6 +8,7 @@ struct DebugFeatures {
   inline static bool showTextBounds{false};
   inline static ngf::TimeSpan renderTime;
   inline static ngf::TimeSpan updateTime;
+  inline static int updateSteps{0};
 };
 
 }
\ No newline at end of file
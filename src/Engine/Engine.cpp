@@ -8,13 +8,16 @@
 #include <filesystem>
 #include <iomanip>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <unordered_set>
 #include <squirrel.h>
 #include <ngf/Application.h>
 #include <ngf/Graphics/Colors.h>
-#include <ngf/System/Mouse.h>
+#include <engge/Input/InputRecorder.hpp>
+#include <engge/Input/InputSource.hpp>
+#include <engge/System/Locator.hpp>
 #include <engge/Util/RandomNumberGenerator.hpp>
 #include <engge/EnggeApplication.hpp>
 #include <engge/Engine/Engine.hpp>
@@ -39,6 +42,7 @@
 #include <engge/Scripting/VerbExecute.hpp>
 #include <engge/System/Logger.hpp>
 #include <engge/Engine/InputStateConstants.hpp>
+#include "System/FrameProfiler.hpp"
 #include "EngineImpl.hpp"
 
 namespace fs = std::filesystem;
@@ -52,6 +56,7 @@ Engine::Engine() : m_pImpl(std::make_unique<Impl>()) {
   m_pImpl->m_actorIcons.setEngine(this);
   m_pImpl->m_camera.setEngine(this);
   m_pImpl->m_talkingState.setEngine(this);
+  m_pImpl->m_roomPrefetcher.setEngine(this);
 
   // load all messages
   std::stringstream s;
@@ -101,6 +106,8 @@ ng::EnggeApplication *Engine::getApplication() { return m_pImpl->m_pApp; }
 
 ResourceManager &Engine::getResourceManager() { return m_pImpl->m_resourceManager; }
 
+RoomPrefetcher &Engine::getRoomPrefetcher() { return m_pImpl->m_roomPrefetcher; }
+
 Room *Engine::getRoom() { return m_pImpl->m_pRoom; }
 
 std::wstring Engine::getText(int id) {
@@ -123,14 +130,12 @@ std::vector<std::unique_ptr<Room>> &Engine::getRooms() { return m_pImpl->m_rooms
 
 void Engine::addFunction(std::unique_ptr<Function> function) { m_pImpl->m_newFunctions.push_back(std::move(function)); }
 
-void Engine::addCallback(std::unique_ptr<Callback> callback) { m_pImpl->m_callbacks.push_back(std::move(callback)); }
+void Engine::addTimer(std::unique_ptr<TimeFunction> function) { m_pImpl->m_timers.add(std::move(function)); }
+
+void Engine::addCallback(std::unique_ptr<Callback> callback) { m_pImpl->m_callbacks.add(std::move(callback)); }
 
 void Engine::removeCallback(int id) {
-  auto it = std::find_if(m_pImpl->m_callbacks.begin(), m_pImpl->m_callbacks.end(),
-                         [id](auto &callback) -> bool { return callback->getId() == id; });
-  if (it != m_pImpl->m_callbacks.end()) {
-    m_pImpl->m_callbacks.erase(it);
-  }
+  m_pImpl->m_callbacks.removeIf([id](const Callback &callback) { return callback.getId() == id; });
 }
 
 std::vector<std::unique_ptr<Actor>> &Engine::getActors() { return m_pImpl->m_actors; }
@@ -230,10 +235,26 @@ void Engine::setScriptExecute(std::unique_ptr<ScriptExecute> scriptExecute) {
   m_pImpl->m_pScriptExecute = std::move(scriptExecute);
 }
 
-void Engine::addThread(std::unique_ptr<ThreadBase> thread) { m_pImpl->m_threads.push_back(std::move(thread)); }
+void Engine::addThread(std::unique_ptr<ThreadBase> thread) {
+  m_pImpl->m_threadsById.emplace(thread->getId(), thread.get());
+  m_pImpl->m_threadsByVm.emplace(thread->getThread(), thread.get());
+  m_pImpl->m_threads.push_back(std::move(thread));
+}
 
 std::vector<std::unique_ptr<ThreadBase>> &Engine::getThreads() { return m_pImpl->m_threads; }
 
+ThreadBase *Engine::getThread(int id) {
+  auto it = m_pImpl->m_threadsById.find(id);
+  return it != m_pImpl->m_threadsById.end() ? it->second : nullptr;
+}
+
+ThreadBase *Engine::getThread(HSQUIRRELVM v) {
+  auto it = m_pImpl->m_threadsByVm.find(v);
+  return it != m_pImpl->m_threadsByVm.end() ? it->second : nullptr;
+}
+
+ThreadPool &Engine::getThreadPool() { return m_pImpl->m_threadPool; }
+
 glm::vec2 Engine::getMousePositionInRoom() const { return m_pImpl->m_mousePosInRoom; }
 
 Preferences &Engine::getPreferences() { return m_pImpl->m_preferences; }
@@ -246,6 +267,10 @@ Camera &Engine::getCamera() { return m_pImpl->m_camera; }
 
 ngf::TimeSpan Engine::getTime() const { return m_pImpl->m_time; }
 
+void Engine::setRenderInterpolation(float alpha) { m_pImpl->m_renderInterpolation = std::clamp(alpha, 0.f, 1.f); }
+
+float Engine::getRenderInterpolation() const { return m_pImpl->m_renderInterpolation; }
+
 SQInteger Engine::setRoom(Room *pRoom) {
   if (!pRoom)
     return 0;
@@ -254,6 +279,8 @@ SQInteger Engine::setRoom(Room *pRoom) {
   if (pRoom == pOldRoom)
     return 0;
 
+  m_pImpl->m_roomPrefetcher.prefetch(*pRoom);
+
   auto result = m_pImpl->exitRoom(nullptr);
   if (SQ_FAILED(result))
     return result;
@@ -264,6 +291,9 @@ SQInteger Engine::setRoom(Room *pRoom) {
   if (SQ_FAILED(result))
     return result;
 
+  // the positions of the previous room must not be interpolated with the new ones
+  m_pImpl->savePreviousPositions();
+  m_pImpl->m_dialogManager.warm(*pRoom);
   return 0;
 }
 
@@ -271,6 +301,8 @@ SQInteger Engine::enterRoomFromDoor(Object *pDoor) {
   auto dir = pDoor->getUseDirection();
   auto facing = toFacing(dir);
   auto pRoom = pDoor->getRoom();
+  m_pImpl->m_roomPrefetcher.onEnterRoomFromDoor(m_pImpl->m_pRoom, *pDoor);
+  m_pImpl->m_roomPrefetcher.prefetch(*pRoom);
 
   // exit current room
   auto result = m_pImpl->exitRoom(nullptr);
@@ -295,7 +327,14 @@ SQInteger Engine::enterRoomFromDoor(Object *pDoor) {
   }
 
   // enter current room
-  return m_pImpl->enterRoom(pRoom, pDoor);
+  result = m_pImpl->enterRoom(pRoom, pDoor);
+  if (SQ_FAILED(result))
+    return result;
+
+  // the positions of the previous room must not be interpolated with the new ones
+  m_pImpl->savePreviousPositions();
+  m_pImpl->m_dialogManager.warm(*pRoom);
+  return 0;
 }
 
 void Engine::setInputHUD(bool on) { m_pImpl->m_inputHUD = on; }
@@ -315,6 +354,23 @@ void Engine::update(const ngf::TimeSpan &el) {
   if (m_pImpl->m_state == EngineState::Quit)
     return;
 
+  ENGGE_PROFILE_SCOPE("Engine::update");
+
+  m_pImpl->savePreviousPositions();
+  auto &inputSource = Locator<InputSource>::get();
+  if (m_pImpl->m_pInputRecorder) {
+    m_pImpl->m_pInputRecorder->recordFrame(el,
+                                           inputSource.getMousePosition(),
+                                           inputSource.isMouseButtonPressed(ngf::Mouse::Button::Left),
+                                           inputSource.isMouseButtonPressed(ngf::Mouse::Button::Right));
+  }
+
+  {
+    ENGGE_PROFILE_SCOPE("resources");
+    m_pImpl->m_resourceManager.uploadDecodedTextures();
+    m_pImpl->m_savegameWriter.update();
+  }
+
   roomEffect.RandomValue[0] = Locator<RandomNumberGenerator>::get().generateFloat(0, 1.f);
   roomEffect.iGlobalTime = fmod(m_pImpl->m_time.getTotalSeconds(), 1000.f);
   roomEffect.TimeLapse = roomEffect.iGlobalTime;
@@ -326,7 +382,7 @@ void Engine::update(const ngf::TimeSpan &el) {
   m_pImpl->stopThreads();
   auto screenSize = m_pImpl->m_pRoom->getScreenSize();
   auto view = ngf::View{ngf::frect::fromPositionSize({0, 0}, screenSize)};
-  m_pImpl->m_mousePos = m_pImpl->m_pApp->getRenderTarget()->mapPixelToCoords(ngf::Mouse::getPosition(), view);
+  m_pImpl->m_mousePos = m_pImpl->m_pApp->getRenderTarget()->mapPixelToCoords(inputSource.getMousePosition(), view);
   if (m_pImpl->m_pRoom && m_pImpl->m_pRoom->getName() != "Void") {
     auto screenMouse = toDefaultView((glm::ivec2) m_pImpl->m_mousePos, screenSize);
     m_pImpl->m_hud.setMousePosition(screenMouse);
@@ -354,7 +410,7 @@ void Engine::update(const ngf::TimeSpan &el) {
   auto wasMouseDown = m_pImpl->m_isMouseDown && !io.WantCaptureMouse;
   auto wasMouseRightDown = m_pImpl->m_isMouseRightDown;
   m_pImpl->m_isMouseDown =
-      ngf::Mouse::isButtonPressed(ngf::Mouse::Button::Left) && !io.WantCaptureMouse;
+      inputSource.isMouseButtonPressed(ngf::Mouse::Button::Left) && !io.WantCaptureMouse;
   if (!wasMouseDown || !m_pImpl->m_isMouseDown) {
     m_pImpl->m_mouseDownTime = ngf::TimeSpan::seconds(0);
     m_pImpl->run(false);
@@ -364,17 +420,29 @@ void Engine::update(const ngf::TimeSpan &el) {
       m_pImpl->run(true);
     }
   }
-  m_pImpl->m_isMouseRightDown = ngf::Mouse::isButtonPressed(ngf::Mouse::Button::Right) && !io.WantCaptureMouse;
+  m_pImpl->m_isMouseRightDown = inputSource.isMouseButtonPressed(ngf::Mouse::Button::Right) && !io.WantCaptureMouse;
   bool isRightClick = wasMouseRightDown != m_pImpl->m_isMouseRightDown && !m_pImpl->m_isMouseRightDown;
   auto isMouseClick = wasMouseDown != m_pImpl->m_isMouseDown && !m_pImpl->m_isMouseDown;
 
   m_pImpl->m_time += elapsed;
   m_pImpl->m_noOverrideElapsed += elapsed;
 
-  m_pImpl->m_camera.update(elapsed);
-  m_pImpl->m_soundManager.update(elapsed);
-  m_pImpl->updateCutscene(elapsed);
-  m_pImpl->updateFunctions(elapsed);
+  {
+    ENGGE_PROFILE_SCOPE("camera");
+    m_pImpl->m_camera.update(elapsed);
+  }
+  {
+    ENGGE_PROFILE_SCOPE("sound");
+    m_pImpl->m_soundManager.update(elapsed);
+  }
+  {
+    ENGGE_PROFILE_SCOPE("cutscene");
+    m_pImpl->updateCutscene(elapsed);
+  }
+  {
+    ENGGE_PROFILE_SCOPE("functions");
+    m_pImpl->updateFunctions(elapsed);
+  }
   m_pImpl->updateSentence(elapsed);
   m_pImpl->updateKeys();
 
@@ -383,11 +451,17 @@ void Engine::update(const ngf::TimeSpan &el) {
 
   m_pImpl->updateRoomScalings();
 
-  m_pImpl->m_pRoom->update(elapsed);
-  for (auto &pActor : m_pImpl->m_actors) {
-    if (!pActor || pActor->getRoom() == m_pImpl->m_pRoom)
-      continue;
-    pActor->update(elapsed);
+  {
+    ENGGE_PROFILE_SCOPE("room");
+    m_pImpl->m_pRoom->update(elapsed);
+  }
+  {
+    ENGGE_PROFILE_SCOPE("actors");
+    for (auto &pActor : m_pImpl->m_actors) {
+      if (!pActor || pActor->getRoom() == m_pImpl->m_pRoom)
+        continue;
+      pActor->update(elapsed);
+    }
   }
 
   m_pImpl->updateActorIcons(elapsed);
@@ -407,8 +481,11 @@ void Engine::update(const ngf::TimeSpan &el) {
   m_pImpl->m_hud.setActive(
       m_pImpl->m_inputVerbsActive && m_pImpl->m_dialogManager.getState() == DialogManagerState::None
           && m_pImpl->m_pRoom->getFullscreen() != 1);
-  m_pImpl->m_hud.setHoveredEntity(m_pImpl->getHoveredEntity(m_pImpl->m_mousePosInRoom));
-  m_pImpl->updateHoveredEntity(isRightClick);
+  {
+    ENGGE_PROFILE_SCOPE("hover");
+    m_pImpl->m_hud.setHoveredEntity(m_pImpl->getHoveredEntity(m_pImpl->m_mousePosInRoom));
+    m_pImpl->updateHoveredEntity(isRightClick);
+  }
 
   if (m_pImpl->m_pCurrentActor) {
     auto &objects = m_pImpl->m_pCurrentActor->getObjects();
@@ -417,7 +494,10 @@ void Engine::update(const ngf::TimeSpan &el) {
     }
   }
 
-  m_pImpl->m_hud.update(elapsed);
+  {
+    ENGGE_PROFILE_SCOPE("hud");
+    m_pImpl->m_hud.update(elapsed);
+  }
 
   if (m_pImpl->m_actorIcons.isMouseOver())
     return;
@@ -464,7 +544,7 @@ void Engine::update(const ngf::TimeSpan &el) {
   }
 
   if (m_pImpl->m_hud.getHoveredEntity()) {
-    ScriptEngine::rawCall("onObjectClick", m_pImpl->m_hud.getHoveredEntity());
+    m_pImpl->m_onObjectClick.call(ScriptEngine::getRootTable(), m_pImpl->m_hud.getHoveredEntity());
     auto pVerbOverride = m_pImpl->m_hud.getVerbOverride();
     if (!pVerbOverride) {
       pVerbOverride = m_pImpl->m_hud.getCurrentVerb();
@@ -494,11 +574,11 @@ void Engine::setCurrentActor(Actor *pCurrentActor, bool userSelected) {
   m_pImpl->m_hud.setCurrentActorIndex(currentActorIndex);
   m_pImpl->m_hud.setCurrentActor(m_pImpl->m_pCurrentActor);
 
-  ScriptEngine::rawCall("onActorSelected", pCurrentActor, userSelected);
+  m_pImpl->m_onActorSelected.call(ScriptEngine::getRootTable(), pCurrentActor, userSelected);
   auto pRoom = pCurrentActor ? pCurrentActor->getRoom() : nullptr;
   if (pRoom) {
-    if (ScriptEngine::rawExists(pRoom, "onActorSelected")) {
-      ScriptEngine::rawCall(pRoom, "onActorSelected", pCurrentActor, userSelected);
+    if (m_pImpl->m_onRoomActorSelected.exists(pRoom)) {
+      m_pImpl->m_onRoomActorSelected.call(pRoom, pCurrentActor, userSelected);
     }
   }
 
@@ -508,9 +588,16 @@ void Engine::setCurrentActor(Actor *pCurrentActor, bool userSelected) {
 }
 
 void Engine::draw(ngf::RenderTarget &target, bool screenshot) const {
+  // a screenshot is drawn in the middle of a frame, it doesn't start a new one
+  if (!screenshot) {
+    m_pImpl->m_resourceManager.newFrame();
+  }
   if (!m_pImpl->m_pRoom)
     return;
 
+  ENGGE_PROFILE_SCOPE("Engine::draw");
+  m_pImpl->m_renderTargets.collect();
+
   // update room shader if necessary
   ngf::RenderStates states;
   auto effect = m_pImpl->m_pRoom->getEffect();
@@ -548,86 +635,121 @@ void Engine::draw(ngf::RenderTarget &target, bool screenshot) const {
     states.shader = nullptr;
   }
 
-  // render the room to a texture, this allows to create a post process effect: room effect
-  ngf::RenderTexture roomTexture(target.getSize());
   auto screenSize = m_pImpl->m_pRoom->getScreenSize();
   ngf::View view(ngf::frect::fromPositionSize({0, 0}, screenSize));
-  roomTexture.setView(view);
-  roomTexture.clear();
-  m_pImpl->m_pRoom->draw(roomTexture, m_pImpl->m_camera.getRect().getTopLeft());
-  roomTexture.display();
-
-  // then render a sprite with this texture and apply the room effect
-  ngf::RenderTexture roomWithEffectTexture(target.getSize());
-  roomWithEffectTexture.clear();
-  ngf::Sprite sprite(roomTexture.getTexture());
-  sprite.draw(roomWithEffectTexture, states);
-
-  // and render overlay
-  ngf::RectangleShape fadeShape;
-  fadeShape.setSize(roomWithEffectTexture.getSize());
-  fadeShape.setColor(m_pImpl->m_pRoom->getOverlayColor());
-  fadeShape.draw(roomWithEffectTexture, {});
-  roomWithEffectTexture.display();
-
-  // render fade
-  ngf::Sprite fadeSprite;
-  float fade = m_pImpl->m_fadeEffect.effect == FadeEffect::None ? 0.f :
-               std::clamp(
-                   m_pImpl->m_fadeEffect.elapsed.getTotalSeconds() / m_pImpl->m_fadeEffect.duration.getTotalSeconds(),
-                   0.f, 1.f);
-  ngf::RenderTexture roomTexture2(target.getSize());
-  roomTexture2.setView(view);
-  roomTexture2.clear();
-  if (m_pImpl->m_fadeEffect.effect == FadeEffect::Wobble) {
-    m_pImpl->m_fadeEffect.room->draw(roomTexture2, m_pImpl->m_fadeEffect.cameraTopLeft);
-  }
-  roomTexture2.display();
-
-  ngf::RenderTexture roomTexture3(target.getSize());
-  ngf::Sprite sprite2(roomTexture2.getTexture());
-  sprite2.draw(roomTexture3, {});
-  roomTexture3.display();
-
-  const ngf::Texture *texture1{nullptr};
-  const ngf::Texture *texture2{nullptr};
-  switch (m_pImpl->m_fadeEffect.effect) {
-  case FadeEffect::Wobble:
-  case FadeEffect::In:texture1 = &roomTexture3.getTexture();
-    texture2 = &roomWithEffectTexture.getTexture();
-    break;
-  case FadeEffect::Out:texture1 = &roomWithEffectTexture.getTexture();
-    texture2 = &roomTexture3.getTexture();
-    break;
-  default:texture1 = &roomWithEffectTexture.getTexture();
-    texture2 = &roomWithEffectTexture.getTexture();
-    break;
-  }
-  fadeSprite.setTexture(*texture1);
-  m_pImpl->m_fadeShader.setUniform("u_texture2", *texture2);
-  m_pImpl->m_fadeShader.setUniform("u_fade", fade); // fade value between [0.f,1.f]
-  m_pImpl->m_fadeShader.setUniform("u_fadeToSep", m_pImpl->m_fadeEffect.fadeToSepia ? 1 : 0);  // 1 to fade to sepia
-  m_pImpl->m_fadeShader.setUniform("u_movement",
-                                   sinf(M_PI * fade) * m_pImpl->m_fadeEffect.movement); // movement for wobble effect
-  m_pImpl->m_fadeShader.setUniform("u_timer", m_pImpl->m_fadeEffect.elapsed.getTotalSeconds());
-  states.shader = &m_pImpl->m_fadeShader;
-
-  // apply the room rotation
-  auto pos = target.getView().getSize() / 2.f;
-  fadeSprite.getTransform().setOrigin(pos);
-  fadeSprite.getTransform().setPosition(pos);
-  fadeSprite.getTransform().setRotation(m_pImpl->m_pRoom->getRotation());
-  fadeSprite.draw(target, states);
+  auto cameraOffset = m_pImpl->getRenderCameraOffset();
+  auto overlayColor = m_pImpl->m_pRoom->getOverlayColor();
+  auto rotation = m_pImpl->m_pRoom->getRotation();
+  auto fadeEffect = m_pImpl->m_fadeEffect.effect;
+
+  // without effect, overlay, fade and rotation the passes below only copy the room, so draw it directly
+  if (!states.shader && overlayColor.a == 0 && fadeEffect == FadeEffect::None && rotation == 0) {
+    ENGGE_PROFILE_BEGIN("room");
+    auto orgView = target.getView();
+    target.setView(view);
+    m_pImpl->m_pRoom->draw(target, m_pImpl->m_camera.getRect().getTopLeft() + cameraOffset);
+    target.setView(orgView);
+    ENGGE_PROFILE_END();
+  } else {
+    auto &renderTargets = m_pImpl->m_renderTargets;
+
+    // render the room to a texture, this allows to create a post process effect: room effect
+    ENGGE_PROFILE_BEGIN("room");
+    auto roomTexture = renderTargets.acquire(target.getSize());
+    roomTexture->setView(view);
+    roomTexture->clear();
+    m_pImpl->m_pRoom->draw(*roomTexture, m_pImpl->m_camera.getRect().getTopLeft() + cameraOffset);
+    roomTexture->display();
+    ENGGE_PROFILE_END();
+
+    // then render a sprite with this texture and apply the room effect
+    ENGGE_PROFILE_BEGIN("effect");
+    auto roomWithEffectTexture = renderTargets.acquire(target.getSize());
+    roomWithEffectTexture->clear();
+    ngf::Sprite sprite(roomTexture->getTexture());
+    sprite.draw(*roomWithEffectTexture, states);
+
+    // and render overlay
+    if (overlayColor.a != 0) {
+      ngf::RectangleShape fadeShape;
+      fadeShape.setSize(roomWithEffectTexture->getSize());
+      fadeShape.setColor(overlayColor);
+      fadeShape.draw(*roomWithEffectTexture, {});
+    }
+    roomWithEffectTexture->display();
+    ENGGE_PROFILE_END();
+
+    // render fade
+    ENGGE_PROFILE_BEGIN("fade");
+    ngf::Sprite fadeSprite;
+    float fade = fadeEffect == FadeEffect::None ? 0.f :
+                 std::clamp(
+                     m_pImpl->m_fadeEffect.elapsed.getTotalSeconds() / m_pImpl->m_fadeEffect.duration.getTotalSeconds(),
+                     0.f, 1.f);
+
+    // the fades blend with a second texture: the previous room for a wobble, black for a fade in or out
+    std::optional<RenderTargetPool::Target> roomTexture3;
+    if (fadeEffect != FadeEffect::None) {
+      roomTexture3.emplace(renderTargets.acquire(target.getSize()));
+      (*roomTexture3)->clear();
+      if (fadeEffect == FadeEffect::Wobble) {
+        auto roomTexture2 = renderTargets.acquire(target.getSize());
+        roomTexture2->setView(view);
+        roomTexture2->clear();
+        m_pImpl->m_fadeEffect.room->draw(*roomTexture2, m_pImpl->m_fadeEffect.cameraTopLeft);
+        roomTexture2->display();
+
+        ngf::Sprite sprite2(roomTexture2->getTexture());
+        sprite2.draw(**roomTexture3, {});
+      }
+      (*roomTexture3)->display();
+    }
+
+    const ngf::Texture *texture1{nullptr};
+    const ngf::Texture *texture2{nullptr};
+    switch (fadeEffect) {
+    case FadeEffect::Wobble:
+    case FadeEffect::In:texture1 = &(*roomTexture3)->getTexture();
+      texture2 = &roomWithEffectTexture->getTexture();
+      break;
+    case FadeEffect::Out:texture1 = &roomWithEffectTexture->getTexture();
+      texture2 = &(*roomTexture3)->getTexture();
+      break;
+    default:texture1 = &roomWithEffectTexture->getTexture();
+      texture2 = &roomWithEffectTexture->getTexture();
+      break;
+    }
+    fadeSprite.setTexture(*texture1);
+    m_pImpl->m_fadeShader.setUniform("u_texture2", *texture2);
+    m_pImpl->m_fadeShader.setUniform("u_fade", fade); // fade value between [0.f,1.f]
+    m_pImpl->m_fadeShader.setUniform("u_fadeToSep", m_pImpl->m_fadeEffect.fadeToSepia ? 1 : 0);  // 1 to fade to sepia
+    m_pImpl->m_fadeShader.setUniform("u_movement",
+                                     sinf(M_PI * fade) * m_pImpl->m_fadeEffect.movement); // movement for wobble effect
+    m_pImpl->m_fadeShader.setUniform("u_timer", m_pImpl->m_fadeEffect.elapsed.getTotalSeconds());
+    states.shader = &m_pImpl->m_fadeShader;
+
+    // apply the room rotation
+    auto pos = target.getView().getSize() / 2.f;
+    fadeSprite.getTransform().setOrigin(pos);
+    fadeSprite.getTransform().setPosition(pos);
+    fadeSprite.getTransform().setRotation(rotation);
+    fadeSprite.draw(target, states);
+    ENGGE_PROFILE_END();
+  }
 
   // if we take a screenshot (for savegame) then stop drawing
   if (screenshot)
     return;
 
   // draw dialogs, hud
-  m_pImpl->m_dialogManager.draw(target, {});
-  m_pImpl->drawHud(target);
+  {
+    ENGGE_PROFILE_SCOPE("hud");
+    m_pImpl->m_dialogManager.draw(target, {});
+    m_pImpl->drawHud(target);
+  }
 
   // draw walkboxes, actor texts
+  ENGGE_PROFILE_BEGIN("text");
   auto orgView = target.getView();
   target.setView(view);
   m_pImpl->drawWalkboxes(target);
@@ -648,8 +770,9 @@ void Engine::draw(ngf::RenderTarget &target, bool screenshot) const {
   });
 
   m_pImpl->m_talkingState.draw(target, {});
-  m_pImpl->m_pRoom->drawForeground(target, m_pImpl->m_camera.getAt());
+  m_pImpl->m_pRoom->drawForeground(target, m_pImpl->m_camera.getAt() + cameraOffset);
   target.setView(orgView);
+  ENGGE_PROFILE_END();
 
   // draw actor icons
   if ((m_pImpl->m_dialogManager.getState() == DialogManagerState::None)
@@ -665,6 +788,7 @@ void Engine::draw(ngf::RenderTarget &target, bool screenshot) const {
   }
 
   // draw pause, cursor and no override icon
+  ENGGE_PROFILE_SCOPE("cursor");
   m_pImpl->drawPause(target);
   m_pImpl->drawCursor(target);
   m_pImpl->drawCursorText(target);
@@ -754,6 +878,9 @@ void Engine::fadeTo(FadeEffect effect, const ngf::TimeSpan &duration) {
   m_pImpl->m_fadeEffect.duration = duration;
   m_pImpl->m_fadeEffect.movement = effect == FadeEffect::Wobble ? 0.005f : 0.f;
   m_pImpl->m_fadeEffect.elapsed = ngf::TimeSpan::seconds(0);
+  if (effect == FadeEffect::Out) {
+    m_pImpl->m_roomPrefetcher.onFadeOut();
+  }
 }
 
 FadeEffectParameters &Engine::getFadeParameters() {
@@ -779,16 +906,22 @@ void Engine::stopSentence() {
 }
 
 void Engine::keyDown(const Input &key) {
+  if (m_pImpl->m_pInputRecorder)
+    m_pImpl->m_pInputRecorder->keyDown(key);
   m_pImpl->m_newKeyDowns.insert(key);
 }
 
 void Engine::keyUp(const Input &key) {
+  if (m_pImpl->m_pInputRecorder)
+    m_pImpl->m_pInputRecorder->keyUp(key);
   auto it = m_pImpl->m_newKeyDowns.find(key);
   if (it == m_pImpl->m_newKeyDowns.end())
     return;
   m_pImpl->m_newKeyDowns.erase(it);
 }
 
+void Engine::setInputRecorder(InputRecorder *pRecorder) { m_pImpl->m_pInputRecorder = pRecorder; }
+
 void Engine::sayLineAt(glm::ivec2 pos, ngf::Color color, ngf::TimeSpan duration, const std::string &text) {
   m_pImpl->m_talkingState.setTalkColor(color);
   auto size = getRoom()->getRoomSize();
@@ -833,13 +966,11 @@ Hud &Engine::getHud() { return m_pImpl->m_hud; }
 void Engine::saveGame(int slot) {
   Impl::SaveGameSystem saveGameSystem(m_pImpl.get());
   auto path = Impl::SaveGameSystem::getSlotPath(slot);
-  std::filesystem::path screenshotPath(path);
-  screenshotPath.replace_extension(".png");
-  m_pImpl->captureScreen(screenshotPath.string());
-  saveGameSystem.saveGame(path);
+  saveGameSystem.saveGame(path, m_pImpl->captureScreen());
 }
 
 void Engine::loadGame(int slot) {
+  m_pImpl->m_savegameWriter.wait();
   Impl::SaveGameSystem saveGameSystem(m_pImpl.get());
   saveGameSystem.loadGame(Impl::SaveGameSystem::getSlotPath(slot).string());
 }
@@ -862,6 +993,8 @@ Entity *Engine::getEntity(const std::string &name) {
 }
 
 void Engine::getSlotSavegames(std::vector<SavegameSlot> &slots) {
+  // a savegame being written can't be read yet
+  Locator<Engine>::get().m_pImpl->m_savegameWriter.wait();
   for (int i = 1; i <= 9; ++i) {
     auto path = Impl::SaveGameSystem::getSlotPath(i);
 
@@ -307,7 +307,18 @@ void Engine::Impl::updateSentence(const ngf::TimeSpan &elapsed) const {
 }
 
 void Engine::Impl::updateFunctions(const ngf::TimeSpan &elapsed) {
+  m_timers.update(elapsed);
+
+  auto &waitQueue = Locator<WaitQueue>::get();
+  for (auto &function : waitQueue.takeSignaled()) {
+    m_newFunctions.push_back(std::move(function));
+  }
   for (auto &function : m_newFunctions) {
+    // functions waiting for an event are parked until its producer signals it
+    if (function->getWaitKey() && !function->isElapsed()) {
+      waitQueue.wait(std::move(function));
+      continue;
+    }
     m_functions.push_back(std::move(function));
   }
   m_newFunctions.clear();
@@ -318,17 +329,7 @@ void Engine::Impl::updateFunctions(const ngf::TimeSpan &elapsed) {
                                    [](std::unique_ptr<Function> &f) { return f->isElapsed(); }),
                     m_functions.end());
 
-  std::vector<std::unique_ptr<Callback>> callbacks;
-  std::move(m_callbacks.begin(), m_callbacks.end(), std::back_inserter(callbacks));
-  m_callbacks.clear();
-  for (auto &callback : callbacks) {
-    (*callback)(elapsed);
-  }
-  callbacks.erase(std::remove_if(callbacks.begin(),
-                                 callbacks.end(),
-                                 [](auto &f) { return f->isElapsed(); }),
-                  callbacks.end());
-  std::move(callbacks.begin(), callbacks.end(), std::back_inserter(m_callbacks));
+  m_callbacks.update(elapsed);
 }
 
 void Engine::Impl::updateActorIcons(const ngf::TimeSpan &elapsed) {
@@ -945,9 +946,44 @@ void Engine::Impl::drawPause(ngf::RenderTarget &target) const {
 }
 
 void Engine::Impl::stopThreads() {
-  m_threads.erase(std::remove_if(m_threads.begin(), m_threads.end(), [](const auto &t) -> bool {
-    return !t || t->isStopped();
+  std::vector<HSQUIRRELVM> stoppedVms;
+  m_threads.erase(std::remove_if(m_threads.begin(), m_threads.end(), [this, &stoppedVms](const auto &t) -> bool {
+    if (!t)
+      return true;
+    if (!t->isStopped())
+      return false;
+    auto itId = m_threadsById.find(t->getId());
+    if (itId != m_threadsById.end() && itId->second == t.get())
+      m_threadsById.erase(itId);
+    auto itVm = m_threadsByVm.find(t->getThread());
+    if (itVm != m_threadsByVm.end() && itVm->second == t.get())
+      m_threadsByVm.erase(itVm);
+    stoppedVms.push_back(t->getThread());
+    return true;
   }), m_threads.end());
+
+  // the threads have released their VM, so they can be reused
+  for (auto vm : stoppedVms) {
+    m_threadPool.recycle(vm);
+  }
+}
+
+void Engine::Impl::savePreviousPositions() {
+  m_previousCameraAt = m_camera.getAt();
+  for (auto &pActor : m_actors) {
+    if (pActor)
+      pActor->savePreviousPosition();
+  }
+  if (!m_pRoom)
+    return;
+  for (auto &pObject : m_pRoom->getObjects()) {
+    pObject->savePreviousPosition();
+  }
+}
+
+glm::vec2 Engine::Impl::getRenderCameraOffset() const {
+  auto at = m_camera.getAt();
+  return interpolatePosition(m_previousCameraAt, at, m_renderInterpolation) - at;
 }
 
 void Engine::Impl::drawCursor(ngf::RenderTarget &target) const {
@@ -1175,12 +1211,13 @@ void Engine::Impl::drawHud(ngf::RenderTarget &target) const {
   m_hud.draw(target, {});
 }
 
-void Engine::Impl::captureScreen(const std::string &path) const {
+std::unique_ptr<ngf::Image> Engine::Impl::captureScreen() const {
   ngf::RenderTexture target({320, 180});
+  target.clear();
   m_pEngine->draw(target, true);
   target.display();
 
-  auto screenshot = target.capture();
-  screenshot.saveToFile(path);
+  // the image is encoded to PNG by the savegame writer
+  return std::make_unique<ngf::Image>(target.capture());
 }
 }
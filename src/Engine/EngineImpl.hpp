@@ -15,7 +15,9 @@
 #include <engge/Engine/Preferences.hpp>
 #include <engge/Room/Room.hpp>
 #include <engge/Room/RoomScaling.hpp>
+#include <engge/Engine/RoomPrefetcher.hpp>
 #include <engge/Graphics/Screen.hpp>
+#include <engge/Scripting/ScriptCallback.hpp>
 #include <engge/Scripting/ScriptEngine.hpp>
 #include <engge/Scripting/ScriptExecute.hpp>
 #include <engge/Engine/Sentence.hpp>
@@ -24,7 +26,10 @@
 #include <engge/Graphics/SpriteSheet.hpp>
 #include <engge/Engine/TextDatabase.hpp>
 #include <engge/Engine/Thread.hpp>
+#include <engge/Engine/ThreadPool.hpp>
+#include <engge/Engine/TimerQueue.hpp>
 #include <engge/Engine/Verb.hpp>
+#include <engge/Engine/WaitQueue.hpp>
 #include <engge/Scripting/VerbExecute.hpp>
 #include <squirrel.h>
 #include "../../extlibs/squirrel/squirrel/sqpcheader.h"
@@ -47,7 +52,9 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <ngf/Graphics/Image.h>
 #include <ngf/Graphics/Sprite.h>
 #include <ngf/Graphics/RenderTexture.h>
 #include <ngf/Graphics/RectangleShape.h>
@@ -58,10 +65,12 @@
 #include <engge/Engine/EngineCommands.hpp>
 #include <engge/System/Logger.hpp>
 #include <engge/Parsers/SavegameManager.hpp>
+#include <engge/Parsers/SavegameWriter.hpp>
 #include "DebugFeatures.hpp"
 #include "Entities/TalkingState.hpp"
 #include "Graphics/WalkboxDrawable.hpp"
 #include "Graphics/GraphDrawable.hpp"
+#include "Graphics/RenderTargetPool.hpp"
 #include "Shaders.hpp"
 namespace fs = std::filesystem;
 
@@ -91,7 +100,7 @@ struct Engine::Impl {
   public:
     explicit SaveGameSystem(Engine::Impl *pImpl) : m_pImpl(pImpl) {}
 
-    void saveGame(const std::filesystem::path &path) {
+    void saveGame(const std::filesystem::path &path, std::unique_ptr<ngf::Image> screenshot) {
       ScriptEngine::call("preSave");
 
       time_t now;
@@ -124,11 +133,12 @@ struct Engine::Impl {
           {"version", 2},
       };
 
-      SavegameManager::saveGame(path, saveGameHash);
+      info("Save game snapshot in {} s", watch.getElapsedTime().getTotalSeconds());
 
-      info("Save game in {} s", watch.getElapsedTime().getTotalSeconds());
-
-      ScriptEngine::call("postSave");
+      // the savegame is serialized and written in background, the scripts are notified once it's done
+      m_pImpl->m_savegameWriter.save(path, std::move(saveGameHash), std::move(screenshot), [] {
+        ScriptEngine::call("postSave");
+      });
     }
 
     void loadGame(const std::string &path) {
@@ -150,10 +160,18 @@ struct Engine::Impl {
     }
 
     static void getSlot(SavegameSlot &slot) {
-      auto hash = SavegameManager::loadGame(slot.path);
-      slot.easyMode = hash["easy_mode"].getInt() != 0;
-      slot.savetime = (time_t) hash["savetime"].getInt();
-      slot.gametime = ngf::TimeSpan::seconds(static_cast<float>(hash["gameTime"].getDouble()));
+      auto info = SavegameManager::loadInfo(slot.path);
+      if (!info.has_value()) {
+        // no valid sidecar file for this savegame: decrypt it once and rebuild the sidecar
+        auto hash = SavegameManager::loadGame(slot.path);
+        if (hash.isNull())
+          return;
+        info = SavegameManager::getInfo(hash);
+        SavegameManager::saveInfo(slot.path, *info);
+      }
+      slot.easyMode = info->easyMode;
+      slot.savetime = (time_t) info->savetime;
+      slot.gametime = ngf::TimeSpan::seconds(static_cast<float>(info->gameTime));
     }
 
   private:
@@ -309,7 +327,7 @@ struct Engine::Impl {
         auto time = ngf::TimeSpan::seconds(static_cast<float>(callBackHash["time"].getInt()) / 1000.f);
         auto arg = toSquirrel(callBackHash["param"]);
         auto callback = std::make_unique<Callback>(id, time, name, arg);
-        m_pImpl->m_callbacks.push_back(std::move(callback));
+        m_pImpl->m_callbacks.add(std::move(callback));
       }
       Locator<EntityManager>::get().setCallbackId(hash["nextGuid"].getInt());
     }
@@ -571,6 +589,8 @@ struct Engine::Impl {
       ScriptEngine::set("SAVEBUILD", hash["savebuild"].getInt());
 
       ScriptEngine::call("postLoad");
+      // the loaded positions are not a move
+      m_pImpl->savePreviousPositions();
     }
 
     void setActor(const std::string &name) {
@@ -824,12 +844,21 @@ struct Engine::Impl {
     }
 
     [[nodiscard]] ngf::GGPackValue saveCallbacks() const {
+      std::vector<std::pair<const Callback *, ngf::TimeSpan>> callbacks;
+      m_pImpl->m_callbacks.forEach([&callbacks](const Callback &callback, const ngf::TimeSpan &elapsed) {
+        callbacks.emplace_back(&callback, elapsed);
+      });
+      // save them in the order they have been created
+      std::sort(callbacks.begin(), callbacks.end(), [](const auto &a, const auto &b) {
+        return a.first->getId() < b.first->getId();
+      });
+
       ngf::GGPackValue callbacksArray;
-      for (auto &callback : m_pImpl->m_callbacks) {
+      for (const auto &[callback, elapsed] : callbacks) {
         ngf::GGPackValue callbackHash{
             {"function", callback->getMethod()},
             {"guid", callback->getId()},
-            {"time", callback->getElapsed().getTotalMilliseconds()}
+            {"time", elapsed.getTotalMilliseconds()}
         };
         auto arg = callback->getArgument();
         if (arg._type != OT_NULL) {
@@ -880,12 +909,14 @@ struct Engine::Impl {
   int m_roomEffect{0};
   ngf::Shader m_roomShader;
   ngf::Shader m_fadeShader;
+  RenderTargetPool m_renderTargets;
   ngf::Texture m_blackTexture;
   std::vector<std::unique_ptr<Actor>> m_actors;
   std::vector<std::unique_ptr<Room>> m_rooms;
   std::vector<std::unique_ptr<Function>> m_newFunctions;
   std::vector<std::unique_ptr<Function>> m_functions;
-  std::vector<std::unique_ptr<Callback>> m_callbacks;
+  TimerQueue<Callback> m_callbacks;
+  TimerQueue<TimeFunction> m_timers;
   Cutscene *m_pCutscene{nullptr};
   ng::EnggeApplication *m_pApp{nullptr};
   Actor *m_pCurrentActor{nullptr};
@@ -899,9 +930,15 @@ struct Engine::Impl {
   Entity *m_pObj2{nullptr};
   glm::vec2 m_mousePos{0, 0};
   glm::vec2 m_mousePosInRoom{0, 0};
+  InputRecorder *m_pInputRecorder{nullptr};
+  float m_renderInterpolation{1.f};
+  glm::vec2 m_previousCameraAt{0, 0};
   std::unique_ptr<VerbExecute> m_pVerbExecute;
   std::unique_ptr<ScriptExecute> m_pScriptExecute;
+  ThreadPool m_threadPool;
   std::vector<std::unique_ptr<ThreadBase>> m_threads;
+  std::unordered_map<int, ThreadBase *> m_threadsById;
+  std::unordered_map<HSQUIRRELVM, ThreadBase *> m_threadsByVm;
   DialogManager m_dialogManager;
   Preferences &m_preferences;
   SoundManager &m_soundManager;
@@ -930,6 +967,11 @@ struct Engine::Impl {
   bool m_autoSave{true};
   bool m_cursorVisible{true};
   FadeEffectParameters m_fadeEffect;
+  RoomPrefetcher m_roomPrefetcher;
+  SavegameWriter m_savegameWriter;
+  ScriptCallback m_onObjectClick{"onObjectClick"};
+  ScriptCallback m_onActorSelected{"onActorSelected"};
+  ScriptCallback m_onRoomActorSelected{"onActorSelected"};
 
   Impl();
 
@@ -970,6 +1012,8 @@ struct Engine::Impl {
   static InputConstants toKey(const std::string &keyText);
   void drawPause(ngf::RenderTarget &target) const;
   void stopThreads();
+  void savePreviousPositions();
+  [[nodiscard]] glm::vec2 getRenderCameraOffset() const;
   void drawWalkboxes(ngf::RenderTarget &target) const;
   const Verb *getHoveredVerb() const;
   static std::wstring getDisplayName(const std::wstring &name);
@@ -978,7 +1022,7 @@ struct Engine::Impl {
   void stopTalkingExcept(Entity *pEntity) const;
   Entity *getEntity(Entity *pEntity) const;
   const Verb *overrideVerb(const Verb *pVerb) const;
-  void captureScreen(const std::string &path) const;
+  [[nodiscard]] std::unique_ptr<ngf::Image> captureScreen() const;
   void skipText() const;
   void skipCutscene();
   void pauseGame();
@@ -1,5 +1,14 @@
+#include <algorithm>
+#include <fstream>
 #include <sstream>
 #include <filesystem>
+#include <optional>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include "engge/System/Locator.hpp"
 #include "engge/System/Logger.hpp"
 #include "engge/Engine/Preferences.hpp"
@@ -13,6 +22,47 @@ void throwEntryNotFound(const std::string &name) {
   s = "File '" + name + "' not found in ggpack files.";
   throw std::logic_error(s);
 }
+
+std::string toKey(std::string name) {
+  std::transform(name.begin(), name.end(), name.begin(),
+                 [](unsigned char c) { return static_cast<char>(::tolower(c)); });
+  return name;
+}
+
+std::optional<ng::EntryView> mapFile(const fs::path &path, bool nullTerminated) {
+#ifdef _WIN32
+  return std::nullopt;
+#else
+  auto fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0)
+    return std::nullopt;
+
+  struct stat st{};
+  if (::fstat(fd, &st) != 0) {
+    ::close(fd);
+    return std::nullopt;
+  }
+
+  // a null terminated view relies on the end of the last page being zero-filled,
+  // except when the file fills it completely, in that case it is read as usual
+  auto size = static_cast<size_t>(st.st_size);
+  auto pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+  if (size == 0 || (nullTerminated && (size % pageSize) == 0)) {
+    ::close(fd);
+    return std::nullopt;
+  }
+
+  auto pData = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (pData == MAP_FAILED)
+    return std::nullopt;
+
+  std::shared_ptr<const char> data(static_cast<const char *>(pData), [size](const char *p) {
+    ::munmap(const_cast<char *>(p), size);
+  });
+  return ng::EntryView(std::move(data), size);
+#endif
+}
 }
 
 namespace ng {
@@ -32,53 +82,90 @@ void EngineSettings::loadPacks() {
       m_packs.push_back(std::move(pack));
     }
   }
+  indexEntries();
 }
 
-bool EngineSettings::hasEntry(const std::string &name) {
-  std::ifstream is;
-  is.open(name);
-  if (is.is_open()) {
-    is.close();
-    return true;
+void EngineSettings::indexEntries() {
+  m_entries.clear();
+
+  // the first pack containing an entry wins
+  for (const auto &pack : m_packs) {
+    for (const auto &itEntry : *pack) {
+      Entry entry;
+      entry.pack = pack.get();
+      m_entries.emplace(toKey(itEntry.first), entry);
+    }
   }
-  auto it = std::find_if(m_packs.cbegin(), m_packs.cend(), [&name](const auto &pack) {
-    return pack->contains(name);
-  });
-  return it != m_packs.end();
+
+  // loose files in the working directory override the pack entries
+  std::error_code ec;
+  for (const auto &file : fs::directory_iterator(fs::current_path(), ec)) {
+    if (!file.is_regular_file(ec))
+      continue;
+    auto &entry = m_entries[toKey(file.path().filename().string())];
+    entry.file = file.path();
+  }
+  info("{} entries indexed", m_entries.size());
+}
+
+const EngineSettings::Entry *EngineSettings::getEntry(const std::string &name) const {
+  auto it = m_entries.find(toKey(name));
+  if (it == m_entries.end())
+    return nullptr;
+  return &it->second;
+}
+
+bool EngineSettings::hasEntry(const std::string &name) const {
+  return getEntry(name) != nullptr;
 }
 
 std::vector<char> EngineSettings::readBuffer(const std::string &name) const {
+  const auto *pEntry = getEntry(name);
+  if (!pEntry) {
+    throwEntryNotFound(name);
+    assert(false);
+  }
+
   // first try to find the resource in the filesystem
-  std::ifstream is;
-  is.open(name);
-  if (is.is_open()) {
-    is.seekg(0, std::ios::end);
-    auto size = is.tellg();
-    std::vector<char> data;
-    data.resize(size);
-    is.seekg(0, std::ios::beg);
-    is.read(data.data(), size);
-    is.close();
-    return data;
+  if (!pEntry->file.empty()) {
+    std::ifstream is(pEntry->file, std::ios::binary);
+    if (is.is_open()) {
+      is.seekg(0, std::ios::end);
+      auto size = is.tellg();
+      std::vector<char> data;
+      // one more byte for the null character appended by EntryView
+      data.reserve(static_cast<std::size_t>(size) + 1);
+      data.resize(size);
+      is.seekg(0, std::ios::beg);
+      is.read(data.data(), size);
+      return data;
+    }
   }
 
   // not found in filesystem, check in the pack files
-  auto it = std::find_if(m_packs.cbegin(), m_packs.cend(), [&name](const auto &pack) {
-    return pack->contains(name);
-  });
-  if (it != m_packs.end()) {
-    return it->get()->readEntry(name);
+  if (pEntry->pack) {
+    std::lock_guard<std::mutex> lock(m_packMutex);
+    return pEntry->pack->readEntry(name);
   }
   throwEntryNotFound(name);
   assert(false);
 }
 
+EntryView EngineSettings::readView(const std::string &name, bool nullTerminated) const {
+  const auto *pEntry = getEntry(name);
+  if (pEntry && !pEntry->file.empty()) {
+    auto view = mapFile(pEntry->file, nullTerminated);
+    if (view.has_value())
+      return *view;
+  }
+  return EntryView(readBuffer(name), nullTerminated);
+}
+
 ngf::GGPackValue EngineSettings::readEntry(const std::string &name) const {
-  auto it = std::find_if(m_packs.cbegin(), m_packs.cend(), [&name](const auto &pack) {
-    return pack->contains(name);
-  });
-  if (it != m_packs.end()) {
-    return it->get()->readHashEntry(name);
+  const auto *pEntry = getEntry(name);
+  if (pEntry && pEntry->pack) {
+    std::lock_guard<std::mutex> lock(m_packMutex);
+    return pEntry->pack->readHashEntry(name);
   }
   throwEntryNotFound(name);
   assert(false);
@@ -1,4 +1,3 @@
-#include <algorithm>
 #include <engge/Audio/SoundId.hpp>
 #include <engge/Audio/SoundManager.hpp>
 #include <engge/Engine/Cutscene.hpp>
@@ -12,44 +11,82 @@
 #include <engge/System/Locator.hpp>
 
 namespace ng {
+template<typename T>
+void EntityManager::setSlot(std::vector<T *> &slots, std::size_t index, T *pValue) {
+  if (index >= slots.size()) {
+    slots.resize(index + 1, nullptr);
+  }
+  slots[index] = pValue;
+}
+
+template<typename T>
+void EntityManager::resetSlot(std::vector<T *> &slots, std::size_t index, const T *pValue) {
+  if (index < slots.size() && slots[index] == pValue) {
+    slots[index] = nullptr;
+  }
+}
+
+template<typename T>
+T *EntityManager::getSlot(const std::vector<T *> &slots, int index) {
+  if (index < 0 || static_cast<std::size_t>(index) >= slots.size())
+    return nullptr;
+  return slots[index];
+}
+
+void EntityManager::addActor(Actor *pActor) {
+  setSlot(m_actors, pActor->getId() - START_ACTORID, pActor);
+}
+
+void EntityManager::removeActor(const Actor *pActor) {
+  resetSlot(m_actors, pActor->getId() - START_ACTORID, pActor);
+}
+
+void EntityManager::addRoom(Room *pRoom) {
+  setSlot(m_rooms, pRoom->getId() - START_ROOMID, pRoom);
+}
+
+void EntityManager::removeRoom(const Room *pRoom) {
+  resetSlot(m_rooms, pRoom->getId() - START_ROOMID, pRoom);
+}
+
+void EntityManager::addObject(Object *pObject) {
+  setSlot(m_objects, pObject->getId() - START_OBJECTID, pObject);
+}
+
+void EntityManager::removeObject(const Object *pObject) {
+  resetSlot(m_objects, pObject->getId() - START_OBJECTID, pObject);
+}
+
+void EntityManager::addLight(Light *pLight) {
+  setSlot(m_lights, pLight->getId() - START_LIGHTID, pLight);
+}
+
+void EntityManager::removeLight(const Light *pLight) {
+  resetSlot(m_lights, pLight->getId() - START_LIGHTID, pLight);
+}
+
 Actor *EntityManager::getActorFromId(int id) {
   if (!EntityManager::isActor(id))
     return nullptr;
-
-  for (auto &&actor : ng::Locator<ng::Engine>::get().getActors()) {
-    if (actor->getId() == id)
-      return actor.get();
-  }
-  return nullptr;
+  return getSlot(ng::Locator<EntityManager>::get().m_actors, id - START_ACTORID);
 }
 
 Object *EntityManager::getObjectFromId(int id) {
   if (!EntityManager::isObject(id))
     return nullptr;
-  auto currentRoom = ng::Locator<ng::Engine>::get().getRoom();
-  if (currentRoom) {
-    for (auto &&obj : currentRoom->getObjects()) {
-      if (obj->getId() == id)
-        return obj.get();
-    }
-  }
-  for (auto &&room : ng::Locator<ng::Engine>::get().getRooms()) {
-    for (auto &&obj : room->getObjects()) {
-      if (obj->getId() == id)
-        return obj.get();
-    }
-  }
-  return nullptr;
+  return getSlot(ng::Locator<EntityManager>::get().m_objects, id - START_OBJECTID);
 }
 
 Room *EntityManager::getRoomFromId(int id) {
   if (!EntityManager::isRoom(id))
     return nullptr;
-  for (auto &&room : ng::Locator<ng::Engine>::get().getRooms()) {
-    if (room->getId() == id)
-      return room.get();
-  }
-  return nullptr;
+  return getSlot(ng::Locator<EntityManager>::get().m_rooms, id - START_ROOMID);
+}
+
+Light *EntityManager::getLightFromId(int id) {
+  if (!EntityManager::isLight(id))
+    return nullptr;
+  return getSlot(ng::Locator<EntityManager>::get().m_lights, id - START_LIGHTID);
 }
 
 Sound *EntityManager::getSoundFromId(int id) {
@@ -71,15 +108,7 @@ Sound *EntityManager::getSoundFromId(int id) {
 ThreadBase *EntityManager::getThreadFromId(int id) {
   if (!EntityManager::isThread(id))
     return nullptr;
-
-  auto &threads = ng::Locator<ng::Engine>::get().getThreads();
-  auto it = std::find_if(threads.begin(), threads.end(), [id](auto &t) -> bool {
-    return t->getId() == id;
-  });
-  if (it != threads.end())
-    return (*it).get();
-
-  return nullptr;
+  return ng::Locator<ng::Engine>::get().getThread(id);
 }
 
 ThreadBase *EntityManager::getThreadFromVm(HSQUIRRELVM v) {
@@ -87,15 +116,7 @@ ThreadBase *EntityManager::getThreadFromVm(HSQUIRRELVM v) {
   if (pCutscene && pCutscene->getThread() == v) {
     return pCutscene;
   }
-
-  auto &threads = ng::Locator<ng::Engine>::get().getThreads();
-  auto it = std::find_if(threads.begin(), threads.end(), [v](auto &t) -> bool {
-    return t->getThread() == v;
-  });
-  if (it != threads.end())
-    return (*it).get();
-
-  return nullptr;
+  return ng::Locator<ng::Engine>::get().getThread(v);
 }
 
 Entity *EntityManager::getEntity(HSQUIRRELVM v, SQInteger index) {
@@ -1,7 +1,7 @@
 #include <algorithm>
 #include <ngf/Graphics/RectangleShape.h>
 #include <ngf/Graphics/Sprite.h>
-#include <ngf/System/Mouse.h>
+#include <engge/Input/InputSource.hpp>
 #include <engge/Engine/Engine.hpp>
 #include <engge/Engine/Inventory.hpp>
 #include <engge/Entities/Object.hpp>
@@ -74,7 +74,7 @@ bool Inventory::update(const ngf::TimeSpan &elapsed) {
     }
   }
 
-  auto mouseDown = ngf::Mouse::isButtonPressed(ngf::Mouse::Button::Left);
+  auto mouseDown = Locator<InputSource>::get().isMouseButtonPressed(ngf::Mouse::Button::Left);
   if (!m_mouseWasDown || mouseDown) {
     m_mouseWasDown = mouseDown;
     return false;
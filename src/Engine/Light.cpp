@@ -6,8 +6,11 @@ namespace ng {
 Light::Light() {
   sq_resetobject(&table);
   m_id = Locator<EntityManager>::get().getLightId();
+  Locator<EntityManager>::get().addLight(this);
 }
 
-Light::~Light() = default;
+Light::~Light() {
+  Locator<EntityManager>::get().removeLight(this);
+}
 
 } // namespace ng
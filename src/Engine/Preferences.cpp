@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <ngf/IO/Json/JsonParser.h>
 #include "engge/Engine/Preferences.hpp"
 
@@ -30,8 +31,16 @@ void Preferences::removeUserPreference(const std::string &name) {
   }
 }
 
-void Preferences::subscribe(const std::function<void(const std::string &)> &function) {
-  m_functions.emplace_back(function);
+int Preferences::subscribe(const std::function<void(const std::string &)> &function) {
+  auto id = m_nextSubscriptionId++;
+  m_functions.emplace_back(id, function);
+  return id;
+}
+
+void Preferences::unsubscribe(int id) {
+  m_functions.erase(std::remove_if(m_functions.begin(), m_functions.end(), [id](const auto &func) {
+    return func.first == id;
+  }), m_functions.end());
 }
 
 ngf::GGPackValue Preferences::getUserPreferenceCore(const std::string &name,
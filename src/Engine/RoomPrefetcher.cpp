@@ -0,0 +1,85 @@
+#include <engge/Engine/RoomPrefetcher.hpp>
+#include <engge/Engine/Engine.hpp>
+#include <engge/Entities/Actor.hpp>
+#include <engge/Entities/Costume.hpp>
+#include <engge/Entities/Object.hpp>
+#include <engge/Graphics/Animation.hpp>
+#include <engge/Graphics/ResourceManager.hpp>
+#include <engge/Room/Room.hpp>
+#include <engge/System/Locator.hpp>
+#include <engge/System/Logger.hpp>
+
+namespace ng {
+void RoomPrefetcher::onWalkTo(const Entity &entity) {
+  const auto pDoor = dynamic_cast<const Object *>(&entity);
+  if (!pDoor || (pDoor->getFlags() & ObjectFlagConstants::DOOR) != ObjectFlagConstants::DOOR)
+    return;
+
+  m_lastDoorId = pDoor->getId();
+  m_pLastDoorRoom = pDoor->getRoom();
+  auto pDestination = getDestination(m_lastDoorId);
+  if (pDestination) {
+    prefetch(*pDestination);
+  }
+}
+
+void RoomPrefetcher::onFadeOut() {
+  if (!m_pEngine || !m_lastDoorId || m_pLastDoorRoom != m_pEngine->getRoom())
+    return;
+
+  auto pDestination = getDestination(m_lastDoorId);
+  if (pDestination) {
+    prefetch(*pDestination);
+  }
+}
+
+void RoomPrefetcher::onEnterRoomFromDoor(const Room *pFromRoom, const Object &door) {
+  auto pToRoom = door.getRoom();
+  if (!pFromRoom || !pToRoom || pFromRoom == pToRoom)
+    return;
+
+  if (m_lastDoorId && m_pLastDoorRoom == pFromRoom) {
+    m_doorDestinations[m_lastDoorId] = pToRoom;
+  }
+  m_doorDestinations.emplace(door.getId(), pFromRoom);
+  m_lastDoorId = 0;
+  m_pLastDoorRoom = nullptr;
+}
+
+void RoomPrefetcher::prefetch(const Room &room) {
+  trace("Prefetch room {}", room.getName());
+  auto &resourceManager = Locator<ResourceManager>::get();
+  resourceManager.requestTexture(room.getSpriteSheet().getTextureName());
+
+  for (const auto &pObject : room.getObjects()) {
+    for (const auto &anim : pObject->getAnims()) {
+      prefetch(anim);
+    }
+  }
+
+  if (!m_pEngine)
+    return;
+
+  for (const auto &pActor : m_pEngine->getActors()) {
+    if (!pActor || pActor->getRoom() != &room)
+      continue;
+    for (const auto &anim : pActor->getCostume().getAnimations()) {
+      prefetch(anim);
+    }
+  }
+}
+
+void RoomPrefetcher::prefetch(const Animation &animation) {
+  if (!animation.texture.empty()) {
+    Locator<ResourceManager>::get().requestTexture(animation.texture);
+  }
+  for (const auto &layer : animation.layers) {
+    prefetch(layer);
+  }
+}
+
+const Room *RoomPrefetcher::getDestination(int doorId) const {
+  auto it = m_doorDestinations.find(doorId);
+  return it != m_doorDestinations.end() ? it->second : nullptr;
+}
+} // namespace ng
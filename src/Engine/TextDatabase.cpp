@@ -10,8 +10,7 @@ TextDatabase::TextDatabase() = default;
 void TextDatabase::load(const std::string &path) {
   m_texts.clear();
   std::wregex re(L"^(\\d+)\\s+(.*)$");
-  auto buffer = Locator<EngineSettings>::get().readBuffer(path);
-  GGPackBufferStream input(buffer);
+  GGPackBufferStream input(Locator<EngineSettings>::get().readView(path, false));
   std::wstring line;
   while (getLine(input, line)) {
     std::wsmatch matches;
@@ -2,6 +2,7 @@
 #include "engge/System/Locator.hpp"
 #include "engge/Engine/EntityManager.hpp"
 #include "engge/Engine/Thread.hpp"
+#include "Scripting/ScriptProfiler.hpp"
 #include <utility>
 
 namespace ng {
@@ -20,6 +21,7 @@ Thread::Thread(std::string name, bool isGlobal,
 }
 
 Thread::~Thread() {
+  ScriptProfiler::remove(getThread());
   sq_release(m_v, &m_threadObj);
   sq_release(m_v, &m_envObj);
   sq_release(m_v, &m_closureObj);
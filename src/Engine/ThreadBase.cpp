@@ -2,6 +2,7 @@
 #include "engge/System/Locator.hpp"
 #include "engge/System/Logger.hpp"
 #include <engge/Engine/EntityManager.hpp>
+#include "Scripting/ScriptProfiler.hpp"
 
 namespace ng {
 ThreadBase::ThreadBase() {
@@ -26,6 +27,7 @@ bool ThreadBase::pause() {
 void ThreadBase::suspend() {
   if (isSuspended())
     return;
+  ScriptProfiler::suspend(getThread());
   sq_suspendvm(getThread());
   m_isSuspended = true;
 }
@@ -33,6 +35,7 @@ void ThreadBase::suspend() {
 void ThreadBase::resume() {
   if (!isSuspended())
     return;
+  ScriptProfiler::resume(getThread());
   sq_wakeupvm(getThread(), SQFalse, SQFalse, SQTrue, SQFalse);
   m_isSuspended = false;
 }
@@ -0,0 +1,66 @@
+#include <engge/Engine/ThreadPool.hpp>
+#include <engge/Scripting/ScriptEngine.hpp>
+
+namespace ng {
+namespace {
+constexpr SQInteger StackSize = 1024;
+constexpr std::size_t MaxFreeThreads = 64;
+}
+
+ThreadPool::ThreadPool() = default;
+
+ThreadPool::~ThreadPool() {
+  for (auto &item : m_used) {
+    release(item.second);
+  }
+  for (auto &thread : m_free) {
+    release(thread);
+  }
+}
+
+HSQUIRRELVM ThreadPool::acquire(HSQUIRRELVM v) {
+  HSQOBJECT threadObj;
+  sq_resetobject(&threadObj);
+  if (!m_free.empty()) {
+    threadObj = m_free.back();
+    m_free.pop_back();
+    sq_pushobject(v, threadObj);
+    m_stats.reused++;
+  } else {
+    if (!sq_newthread(v, StackSize))
+      return nullptr;
+    sq_getstackobj(v, -1, &threadObj);
+    sq_addref(v, &threadObj);
+    m_stats.created++;
+  }
+  auto thread = threadObj._unVal.pThread;
+  m_used[thread] = threadObj;
+  return thread;
+}
+
+void ThreadPool::recycle(HSQUIRRELVM thread) {
+  auto it = m_used.find(thread);
+  if (it == m_used.end())
+    return;
+  auto threadObj = it->second;
+  m_used.erase(it);
+
+  // a thread stopped while it was suspended or still referenced by a script is not reused
+  auto v = ScriptEngine::getVm();
+  if (v && m_free.size() < MaxFreeThreads && SQ_SUCCEEDED(sq_resetthread(v, thread))) {
+    m_free.push_back(threadObj);
+    m_stats.recycled++;
+    return;
+  }
+  release(threadObj);
+}
+
+void ThreadPool::release(HSQOBJECT &thread) {
+  // the pool can outlive the VM when the application quits
+  auto v = ScriptEngine::getVm();
+  if (v)
+    sq_release(v, &thread);
+  sq_resetobject(&thread);
+  m_stats.released++;
+}
+} // namespace ng
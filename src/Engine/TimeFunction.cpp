@@ -13,6 +13,8 @@ void TimeFunction::operator()(const ngf::TimeSpan &elapsed) {
 
 ngf::TimeSpan TimeFunction::getElapsed() const { return m_elapsed; }
 
+ngf::TimeSpan TimeFunction::getDuration() const { return m_time; }
+
 bool TimeFunction::isElapsed() {
   auto isElapsed = m_elapsed > m_time;
   if (isElapsed && !m_done) {
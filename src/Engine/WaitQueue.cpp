@@ -0,0 +1,28 @@
+#include <engge/Engine/WaitQueue.hpp>
+
+namespace ng {
+WaitQueue::WaitQueue() = default;
+
+WaitQueue::~WaitQueue() = default;
+
+void WaitQueue::wait(std::unique_ptr<Function> function) {
+  auto key = function->getWaitKey();
+  m_waiting[*key].push_back(std::move(function));
+}
+
+void WaitQueue::signal(WaitEvent event, const void *pObject) {
+  auto it = m_waiting.find(WaitKey{event, pObject});
+  if (it == m_waiting.end())
+    return;
+  for (auto &function : it->second) {
+    m_signaled.push_back(std::move(function));
+  }
+  m_waiting.erase(it);
+}
+
+std::vector<std::unique_ptr<Function>> WaitQueue::takeSignaled() {
+  std::vector<std::unique_ptr<Function>> functions;
+  std::swap(functions, m_signaled);
+  return functions;
+}
+} // namespace ng
@@ -6,6 +6,7 @@
 #include <engge/Entities/Object.hpp>
 #include <engge/Room/Room.hpp>
 #include <engge/Room/RoomScaling.hpp>
+#include <engge/Scripting/ScriptCallback.hpp>
 #include <engge/Scripting/ScriptEngine.hpp>
 #include <glm/vec2.hpp>
 #include <ngf/Graphics/RectangleShape.h>
@@ -62,6 +63,7 @@ struct Actor::Impl {
   bool _hotspotVisible{false};
   int _inventoryOffset{0};
   int _fps{10};
+  ScriptCallback _preWalking{"preWalking"};
 };
 
 std::wstring Actor::getTranslatedName() const {
@@ -170,9 +172,12 @@ bool Actor::isInventoryObject() const { return false; }
 Actor::Actor(Engine &engine) : m_pImpl(std::make_unique<Impl>(engine)) {
   m_pImpl->setActor(this);
   m_id = Locator<EntityManager>::get().getActorId();
+  Locator<EntityManager>::get().addActor(this);
 }
 
-Actor::~Actor() = default;
+Actor::~Actor() {
+  Locator<EntityManager>::get().removeActor(this);
+}
 
 const Room *Actor::getRoom() const { return m_pImpl->_pRoom; }
 
@@ -204,7 +209,7 @@ void Actor::draw(ngf::RenderTarget &target, ngf::RenderStates states) const {
     return;
 
   auto scale = getScale();
-  auto transformable = getTransform();
+  auto transformable = getRenderTransform();
   transformable.setScale({scale, scale});
   transformable.setPosition({transformable.getPosition().x + scale * getRenderOffset().x,
                              m_pImpl->_pRoom->getScreenSize().y - transformable.getPosition().y
@@ -237,8 +242,8 @@ std::vector<glm::vec2> Actor::walkTo(const glm::vec2 &destination, std::optional
   }
 
   m_pImpl->_path = std::make_unique<PathDrawable>(path);
-  if (ScriptEngine::rawExists(this, "preWalking")) {
-    ScriptEngine::rawCall(this, "preWalking");
+  if (m_pImpl->_preWalking.exists(this)) {
+    m_pImpl->_preWalking.call(this);
   }
   m_pImpl->_walkingState.setDestination(path, facing);
   return path;
@@ -10,6 +10,7 @@
 #include "JiggleFunction.hpp"
 #include "ShakeFunction.hpp"
 #include "TalkingState.hpp"
+#include "Util/Util.hpp"
 
 namespace ng {
 struct Motor {
@@ -17,6 +18,18 @@ struct Motor {
   std::unique_ptr<Function> function;
 };
 
+// Native copy of the table properties read every frame, refreshed when the table is written.
+struct EntityProperties {
+  SQTable *pTable{nullptr};
+  SQUnsignedInteger version{0};
+  bool isValid{false};
+  bool hidden{false};
+  int flags{0};
+  int touchable{1};
+  int color{0};
+  float volume{1.f};
+};
+
 struct Entity::Impl {
   std::string m_key;
   Engine &m_engine;
@@ -35,8 +48,10 @@ struct Entity::Impl {
   glm::ivec2 m_talkOffset{0, 90};
   TalkingState m_talkingState;
   ngf::Transform m_transform;
+  std::optional<glm::vec2> m_previousPosition;
   Entity *m_pParent{nullptr};
   std::vector<Entity *> m_children;
+  EntityProperties m_properties;
 
   Impl() : m_engine(ng::Locator<ng::Engine>::get()) {
     m_talkingState.setEngine(&m_engine);
@@ -55,6 +70,28 @@ struct Entity::Impl {
       return std::make_optional(value);
     return std::nullopt;
   }
+
+  const EntityProperties &getProperties(const Entity &entity) {
+    auto &table = entity.getTable();
+    auto version = ScriptEngine::getVersion(table);
+    auto &props = m_properties;
+    if (props.isValid && props.pTable == table._unVal.pTable && props.version == version)
+      return props;
+
+    props = EntityProperties();
+    props.pTable = table._unVal.pTable;
+    props.version = version;
+    props.isValid = sq_istable(table);
+    props.color = toInteger(ngf::Colors::White);
+    ScriptEngine::rawGet(table, "_hidden", props.hidden);
+    ScriptEngine::rawGet(table, "flags", props.flags);
+    if (!ScriptEngine::rawGet(table, "_touchable", props.touchable)) {
+      ScriptEngine::rawGet(table, "initTouchable", props.touchable);
+    }
+    ScriptEngine::rawGet(table, "_color", props.color);
+    ScriptEngine::rawGet(table, "_volume", props.volume);
+    return props;
+  }
 };
 
 Entity::Entity() : m_pImpl(std::make_unique<Entity::Impl>()) {
@@ -99,9 +136,7 @@ void Entity::setVisible(bool isVisible) {
 }
 
 bool Entity::isVisible() const {
-  auto hidden = false;
-  ScriptEngine::rawGet(getTable(), "_hidden", hidden);
-  return !hidden;
+  return !m_pImpl->getProperties(*this).hidden;
 }
 
 void Entity::setUsePosition(std::optional<glm::vec2> pos) {
@@ -158,9 +193,7 @@ void Entity::setColor(const ngf::Color &color) {
 }
 
 ngf::Color Entity::getColor() const {
-  auto color = toInteger(ngf::Colors::White);
-  ScriptEngine::rawGet(getTable(), "_color", color);
-  return fromRgba(color);
+  return fromRgba(m_pImpl->getProperties(*this).color);
 }
 
 void Entity::setScale(float s) {
@@ -179,6 +212,19 @@ ngf::Transform Entity::getTransform() const {
   return transform;
 }
 
+ngf::Transform Entity::getRenderTransform() const {
+  auto transform = getTransform();
+  if (m_pImpl->m_previousPosition) {
+    auto alpha = m_pImpl->m_engine.getRenderInterpolation();
+    transform.setPosition(interpolatePosition(*m_pImpl->m_previousPosition, transform.getPosition(), alpha));
+  }
+  return transform;
+}
+
+void Entity::savePreviousPosition() {
+  m_pImpl->m_previousPosition = m_pImpl->m_transform.getPosition() + getOffset();
+}
+
 std::optional<glm::vec2> Entity::getUsePosition() const {
   return m_pImpl->m_usePos;
 }
@@ -228,9 +274,7 @@ void Entity::setKey(const std::string &key) { m_pImpl->m_key = key; }
 const std::string &Entity::getKey() const { return m_pImpl->m_key; }
 
 uint32_t Entity::getFlags() const {
-  int flags = 0;
-  ScriptEngine::rawGet(this, "flags", flags);
-  return (uint32_t) flags;
+  return (uint32_t) m_pImpl->getProperties(*this).flags;
 }
 
 void Entity::setTouchable(bool isTouchable) {
@@ -238,13 +282,10 @@ void Entity::setTouchable(bool isTouchable) {
 }
 
 bool Entity::isTouchable() const {
-  if (!isVisible())
+  const auto &props = m_pImpl->getProperties(*this);
+  if (props.hidden)
     return false;
-  int touchable = 1;
-  if (!ScriptEngine::rawGet(getTable(), "_touchable", touchable)) {
-    ScriptEngine::rawGet(getTable(), "initTouchable", touchable);
-  }
-  return touchable != 0;
+  return props.touchable != 0;
 }
 
 void Entity::setRenderOffset(const glm::ivec2 &offset) {
@@ -422,9 +463,7 @@ void Entity::setVolume(float volume) {
 }
 
 float Entity::getVolume() const {
-  float volume = 1.f;
-  ScriptEngine::rawGet(getTable(), "_volume", volume);
-  return volume;
+  return m_pImpl->getProperties(*this).volume;
 }
 
 } // namespace ng
\ No newline at end of file
@@ -71,15 +71,19 @@ struct Object::Impl {
 
 Object::Object() : pImpl(std::make_unique<Impl>()) {
   m_id = Locator<EntityManager>::get().getObjectId();
+  Locator<EntityManager>::get().addObject(this);
   ScriptEngine::set(this, "_id", m_id);
 }
 
 Object::Object(HSQOBJECT obj) : pImpl(std::make_unique<Impl>(obj)) {
   m_id = Locator<EntityManager>::get().getObjectId();
+  Locator<EntityManager>::get().addObject(this);
   ScriptEngine::set(this, "_id", m_id);
 }
 
-Object::~Object() = default;
+Object::~Object() {
+  Locator<EntityManager>::get().removeObject(this);
+}
 
 void Object::setZOrder(int zorder) { pImpl->zorder = zorder; }
 
@@ -274,7 +278,7 @@ void Object::draw(ngf::RenderTarget &target, ngf::RenderStates states) const {
     return;
 
   ngf::RenderStates initialStates = states;
-  ngf::Transform t = getTransform();
+  ngf::Transform t = getRenderTransform();
 
   if (pImpl->pAnim) {
     auto pos = t.getPosition();
@@ -1,4 +1,5 @@
 #include <engge/Engine/EngineSettings.hpp>
+#include <engge/Engine/WaitQueue.hpp>
 #include <engge/Graphics/Text.hpp>
 #include "TalkingState.hpp"
 
@@ -28,6 +29,7 @@ void TalkingState::update(const ngf::TimeSpan &elapsed) {
     if (m_ids.empty()) {
       m_isTalking = false;
       m_lipAnim.end();
+      signal();
       return;
     }
     auto[id, text, mumble] = m_ids.front();
@@ -47,6 +49,15 @@ void TalkingState::stop() {
     }
     m_soundId = 0;
   }
+  signal();
+}
+
+void TalkingState::signal() const {
+  if (!m_pEntity)
+    return;
+  auto &waitQueue = Locator<WaitQueue>::get();
+  waitQueue.signal(WaitEvent::Talk, m_pEntity);
+  waitQueue.signal(WaitEvent::Talk, nullptr);
 }
 
 bool TalkingState::isTalking() const { return m_isTalking; }
@@ -211,7 +222,7 @@ void TalkingState::loadId(int id, const std::string &text, bool mumble) {
 
   auto sayLine = tostring(m_sayText);
   const char *pAnim = anim.empty() ? nullptr : anim.data();
-  ScriptEngine::rawCall(m_pEntity, "sayingLine", pAnim, sayLine);
+  m_sayingLine.call(m_pEntity, pAnim, sayLine);
 
   loadActorSpeech(name, hearVoice);
 }
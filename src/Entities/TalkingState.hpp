@@ -4,6 +4,7 @@
 #include <engge/Engine/EntityManager.hpp>
 #include <engge/Graphics/GGFont.hpp>
 #include <engge/Graphics/Screen.hpp>
+#include <engge/Scripting/ScriptCallback.hpp>
 #include <engge/Scripting/ScriptEngine.hpp>
 #include <engge/Audio/SoundId.hpp>
 #include <engge/Engine/Preferences.hpp>
@@ -40,6 +41,7 @@ public:
 private:
   void loadActorSpeech(const std::string &name, bool hearVoice);
   void loadId(int id, const std::string &text, bool mumble);
+  void signal() const;
 
 private:
   Engine *m_pEngine{nullptr};
@@ -53,5 +55,6 @@ private:
   int m_soundId{0};
   std::vector<std::tuple<int, std::string, bool>> m_ids;
   ngf::Transform m_transform;
+  ScriptCallback m_sayingLine{"sayingLine"};
 };
 }
\ No newline at end of file
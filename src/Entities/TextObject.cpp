@@ -59,7 +59,7 @@ void TextObject::draw(ngf::RenderTarget &target, ngf::RenderStates states) const
   txt.setAnchor(toAnchor(m_alignment));
 
   auto height = target.getView().getSize().y;
-  auto transformable = getTransform();
+  auto transformable = getRenderTransform();
   transformable.setPosition({transformable.getPosition().x, height - transformable.getPosition().y});
 
   if (getScreenSpace() == ScreenSpace::Object) {
@@ -1,7 +1,9 @@
 #include "WalkingState.hpp"
 #include <engge/Entities/Actor.hpp>
 #include <engge/Entities/Costume.hpp>
+#include <engge/Engine/WaitQueue.hpp>
 #include <engge/Scripting/ScriptEngine.hpp>
+#include <engge/System/Locator.hpp>
 #include <engge/System/Logger.hpp>
 
 namespace ng {
@@ -21,9 +23,10 @@ void WalkingState::setDestination(const std::vector <glm::vec2> &path, std::opti
 
 void WalkingState::stop() {
   m_isWalking = false;
+  Locator<WaitQueue>::get().signal(WaitEvent::Walk, m_pActor);
   m_pActor->getCostume().setStandState();
-  if (ScriptEngine::rawExists(m_pActor, "postWalking")) {
-    ScriptEngine::objCall(m_pActor, "postWalking");
+  if (m_postWalking.exists(m_pActor)) {
+    m_postWalking.call(m_pActor);
   }
 }
 
@@ -73,8 +76,8 @@ void WalkingState::update(const ngf::TimeSpan &elapsed) {
   if (m_facing.has_value()) {
     m_pActor->getCostume().setFacing(m_facing.value());
   }
-  if (ScriptEngine::rawExists(m_pActor, "actorArrived")) {
-    ScriptEngine::rawCall(m_pActor, "actorArrived");
+  if (m_actorArrived.exists(m_pActor)) {
+    m_actorArrived.call(m_pActor);
   }
 }
 }
\ No newline at end of file
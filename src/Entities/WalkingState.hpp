@@ -4,6 +4,7 @@
 #include <glm/vec2.hpp>
 #include <ngf/System/TimeSpan.h>
 #include <engge/Entities/Facing.hpp>
+#include <engge/Scripting/ScriptCallback.hpp>
 
 namespace ng {
 class Actor;
@@ -27,5 +28,7 @@ private:
   bool m_isWalking{false};
   glm::vec2 m_init{0, 0};
   ngf::TimeSpan m_elapsed;
+  ScriptCallback m_postWalking{"postWalking"};
+  ScriptCallback m_actorArrived{"actorArrived"};
 };
 }
\ No newline at end of file
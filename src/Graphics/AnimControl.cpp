@@ -1,7 +1,11 @@
+#include <engge/Engine/WaitQueue.hpp>
 #include <engge/Graphics/AnimControl.hpp>
+#include <engge/System/Locator.hpp>
 
 namespace ng {
 void AnimControl::setAnimation(Animation *anim) {
+  if (m_anim != anim)
+    signal();
   m_anim = anim;
   stop();
 }
@@ -28,9 +32,13 @@ void AnimControl::stop() {
     return;
   m_anim->state = AnimState::Stopped;
   resetAnim(*m_anim);
+  signal();
 }
 
-void AnimControl::pause() { m_anim->state = AnimState::Pause; }
+void AnimControl::pause() {
+  m_anim->state = AnimState::Pause;
+  signal();
+}
 
 AnimState AnimControl::getState() const {
   if (!m_anim)
@@ -50,6 +58,8 @@ void AnimControl::update(const ngf::TimeSpan &e) {
 
   if (!m_anim->frames.empty()) {
     update(e, *m_anim);
+    if (m_anim->state != AnimState::Play)
+      signal();
     return;
   }
 
@@ -58,12 +68,20 @@ void AnimControl::update(const ngf::TimeSpan &e) {
     update(e, layer);
     isOver &= layer.state == ng::AnimState::Stopped;
   }
-  if (isOver)
+  if (isOver) {
     m_anim->state = ng::AnimState::Stopped;
+    signal();
+  }
 }
 
 bool AnimControl::getLoop() const { return m_loop; }
 
+void AnimControl::signal() const {
+  if (!m_anim)
+    return;
+  Locator<WaitQueue>::get().signal(WaitEvent::Animation, m_anim);
+}
+
 void AnimControl::resetAnim(Animation &anim) {
   if (!anim.frames.empty()) {
     anim.state = ng::AnimState::Stopped;
@@ -89,30 +107,32 @@ void AnimControl::update(const ngf::TimeSpan &e, Animation &animation) const {
   auto fps = getFps(animation);
   assert(fps > 0);
 
-  // frame time elapsed?
+  // several frames can elapse in a single update when the time step is larger than a frame
   const auto frameTime = 1.f / static_cast<float>(fps);
-  if (animation.elapsed.getTotalSeconds() <= frameTime)
-    return;
-
-  animation.elapsed = ngf::TimeSpan::seconds(animation.elapsed.getTotalSeconds() - frameTime);
-  animation.frameIndex++;
-
-  // quit if animation length not reached
-  if (animation.frameIndex != static_cast<int>(animation.frames.size())) {
+  while (animation.elapsed.getTotalSeconds() > frameTime) {
+    animation.elapsed = ngf::TimeSpan::seconds(animation.elapsed.getTotalSeconds() - frameTime);
+    animation.frameIndex++;
+
+    // continue if animation length not reached, a trigger can stop the animation
+    if (animation.frameIndex != static_cast<int>(animation.frames.size())) {
+      trig(animation);
+      if (animation.state != AnimState::Play)
+        return;
+      continue;
+    }
+
+    // loop if requested
+    if (m_loop || animation.loop) {
+      animation.frameIndex = 0;
+      continue;
+    }
+
+    // or stay at the last frame
+    animation.frameIndex = animation.frameIndex - 1;
     trig(animation);
+    animation.state = AnimState::Stopped;
     return;
   }
-
-  // loop if requested
-  if (m_loop || animation.loop) {
-    animation.frameIndex = 0;
-    return;
-  }
-
-  // or stay at the last frame
-  animation.frameIndex = animation.frameIndex - 1;
-  trig(animation);
-  animation.state = AnimState::Stopped;
 }
 
 int AnimControl::getFps(const Animation &animation) {
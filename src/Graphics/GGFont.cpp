@@ -26,7 +26,7 @@ void GGFont::load(const std::string &path) {
   m_path = path + ".png";
   m_jsonFilename = path + ".json";
 
-  auto buffer = Locator<EngineSettings>::get().readBuffer(m_jsonFilename);
+  auto buffer = Locator<EngineSettings>::get().readView(m_jsonFilename);
   m_json = ngf::Json::parse(buffer.data());
 
 #if 0
@@ -36,7 +36,7 @@ void GGFont::load(const std::string &path) {
   o.close();
 #endif
 
-  m_texture = m_resourceManager->getTexture(m_path);
+  m_texture = m_resourceManager->getLoadedTexture(m_path);
 
   for (const auto &jFrame : m_json["frames"].items()) {
     auto sValue = jFrame.key();
@@ -0,0 +1,36 @@
+#include <algorithm>
+#include <iterator>
+#include <ngf/Graphics/View.h>
+#include "RenderTargetPool.hpp"
+
+namespace ng {
+RenderTargetPool::Target RenderTargetPool::acquire(glm::ivec2 size) {
+  auto it = std::find_if(m_entries.begin(), m_entries.end(), [size](const auto &pEntry) {
+    return !pEntry->inUse && pEntry->size == size;
+  });
+  if (it == m_entries.end()) {
+    auto pEntry = std::make_unique<Entry>();
+    pEntry->size = size;
+    pEntry->texture = std::make_unique<ngf::RenderTexture>(size);
+    m_entries.push_back(std::move(pEntry));
+    it = std::prev(m_entries.end());
+  }
+
+  auto pEntry = it->get();
+  pEntry->inUse = true;
+  pEntry->unusedFrames = 0;
+  // the previous user of the texture could have changed its view
+  pEntry->texture->setView(ngf::View(ngf::frect::fromPositionSize({0, 0}, size)));
+  return Target(pEntry);
+}
+
+void RenderTargetPool::collect() {
+  for (auto &pEntry : m_entries) {
+    if (!pEntry->inUse)
+      pEntry->unusedFrames++;
+  }
+  m_entries.erase(std::remove_if(m_entries.begin(), m_entries.end(), [](const auto &pEntry) {
+    return !pEntry->inUse && pEntry->unusedFrames > MaxUnusedFrames;
+  }), m_entries.end());
+}
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <glm/vec2.hpp>
+#include <ngf/Graphics/RenderTexture.h>
+#include "engge/System/NonCopyable.hpp"
+
+namespace ng {
+/// @brief Render textures kept from one frame to the next.
+/// @details A render texture is created only when no free texture of the requested size exists, so the
+/// post process passes don't create a framebuffer and a texture each frame. The textures not acquired
+/// during the last frames, like the ones of the previous window size, are destroyed by `collect`.
+class RenderTargetPool : public NonCopyable {
+private:
+  struct Entry {
+    glm::ivec2 size{0, 0};
+    std::unique_ptr<ngf::RenderTexture> texture;
+    bool inUse{false};
+    int unusedFrames{0};
+  };
+
+public:
+  static constexpr int MaxUnusedFrames = 60;
+
+  /// @brief A render texture acquired from the pool, it is given back when the handle is destroyed.
+  class Target {
+  public:
+    Target(Target &&other) noexcept : m_pEntry(other.m_pEntry) { other.m_pEntry = nullptr; }
+    Target(const Target &) = delete;
+    Target &operator=(const Target &) = delete;
+    Target &operator=(Target &&) = delete;
+    ~Target() {
+      if (m_pEntry)
+        m_pEntry->inUse = false;
+    }
+
+    ngf::RenderTexture &operator*() const { return *m_pEntry->texture; }
+    ngf::RenderTexture *operator->() const { return m_pEntry->texture.get(); }
+
+  private:
+    friend class RenderTargetPool;
+    explicit Target(Entry *pEntry) : m_pEntry(pEntry) {}
+
+    Entry *m_pEntry{nullptr};
+  };
+
+  /// Acquires a render texture of the specified size, its view is reset to cover the whole texture.
+  /// The texture keeps its content of the previous frame and has to be cleared.
+  Target acquire(glm::ivec2 size);
+
+  /// Destroys the textures not acquired during the last `MaxUnusedFrames` calls, called once per frame.
+  void collect();
+
+  [[nodiscard]] std::size_t getSize() const { return m_entries.size(); }
+
+private:
+  std::vector<std::unique_ptr<Entry>> m_entries;
+};
+}
@@ -1,4 +1,6 @@
+#include <algorithm>
 #include "engge/Engine/EngineSettings.hpp"
+#include "engge/Engine/Preferences.hpp"
 #include "engge/Graphics/GGFont.hpp"
 #include "engge/System/Locator.hpp"
 #include "engge/System/Logger.hpp"
@@ -8,12 +10,49 @@
 #include <ngf/IO/MemoryStream.h>
 
 namespace ng {
-ResourceManager::ResourceManager() = default;
-ResourceManager::~ResourceManager() = default;
+namespace {
+constexpr unsigned int MaxDecodingThreads = 4;
 
-void ResourceManager::load(const std::string &id) {
-  info("Load texture {}", id);
-  auto data = Locator<EngineSettings>::get().readBuffer(id);
+size_t getTextureBudgetPreference() {
+  auto budget = Locator<Preferences>::get().getUserPreference(PreferenceNames::EnggeTextureBudget,
+                                                              PreferenceDefaultValues::EnggeTextureBudget);
+  return static_cast<size_t>(std::max(budget, 0)) * 1024 * 1024;
+}
+}
+
+ResourceManager::ResourceManager() {
+  m_textureBudget = getTextureBudgetPreference();
+  m_preferencesSubscription = Locator<Preferences>::get().subscribe([this](const std::string &name) {
+    if (name == PreferenceNames::EnggeTextureBudget) {
+      m_textureBudget = getTextureBudgetPreference();
+    }
+  });
+
+  auto numThreads = std::clamp(std::thread::hardware_concurrency(), 2u, MaxDecodingThreads + 1) - 1;
+  for (auto i = 0u; i < numThreads; ++i) {
+    m_workers.emplace_back([this] { decodeLoop(); });
+  }
+}
+
+ResourceManager::~ResourceManager() {
+  Locator<Preferences>::get().unsubscribe(m_preferencesSubscription);
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopping = true;
+  }
+  m_requestCondition.notify_all();
+  for (auto &worker : m_workers) {
+    worker.join();
+  }
+}
+
+ResourceManager::DecodedImage ResourceManager::decode(const std::string &id) {
+  DecodedImage decoded;
+  decoded.id = id;
+  decoded.image = std::make_unique<ngf::Image>();
+  auto data = Locator<EngineSettings>::get().readView(id, false);
+  decoded.size = data.size();
 
 #if 0
   std::ofstream os(path, std::ios::out|std::ios::binary);
@@ -21,13 +60,111 @@ void ResourceManager::load(const std::string &id) {
   os.close();
 #endif
 
-  ngf::Image img;
-  if (!img.loadFromMemory(data.data(), data.size())) {
+  if (!decoded.image->loadFromMemory(data.data(), data.size())) {
     error("Fail to load texture {}", id);
   }
+  return decoded;
+}
+
+void ResourceManager::decodeLoop() {
+  while (true) {
+    std::string id;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_requestCondition.wait(lock, [this] { return m_stopping || !m_requests.empty(); });
+      if (m_stopping)
+        return;
+      id = std::move(m_requests.front());
+      m_requests.pop_front();
+      m_decoding.insert(id);
+    }
+
+    DecodedImage decoded;
+    try {
+      decoded = decode(id);
+    } catch (const std::exception &e) {
+      error("Fail to load texture {}: {}", id, e.what());
+      decoded.id = id;
+      decoded.image = std::make_unique<ngf::Image>();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_decoding.erase(id);
+      m_decoded.push_back(std::move(decoded));
+    }
+    m_decodedCondition.notify_all();
+  }
+}
+
+void ResourceManager::upload(DecodedImage &decoded) {
+  m_pendingTextures.erase(decoded.id);
+  if (m_textureMap.find(decoded.id) != m_textureMap.end())
+    return;
+
+  info("Load texture {}", decoded.id);
+  auto texture = std::make_shared<ngf::Texture>(*decoded.image);
+  auto texSize = texture->getSize();
+  auto memorySize = static_cast<size_t>(texSize.x) * texSize.y * 4;
+  m_textureMemory += memorySize;
+  m_textureMap.insert(std::make_pair(decoded.id, TextureResource{texture, decoded.size, memorySize, m_frame}));
+}
+
+void ResourceManager::evictTextures() {
+  if (!m_textureBudget || m_textureMemory <= m_textureBudget)
+    return;
+
+  // only the textures used by nobody else than the cache can be evicted, and not those used this frame
+  std::vector<std::map<std::string, TextureResource>::iterator> candidates;
+  for (auto it = m_textureMap.begin(); it != m_textureMap.end(); ++it) {
+    if (it->second.texture.use_count() == 1 && it->second.lastUsedFrame < m_frame - 1) {
+      candidates.push_back(it);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end(), [](const auto &it1, const auto &it2) {
+    return it1->second.lastUsedFrame < it2->second.lastUsedFrame;
+  });
+
+  for (auto &it : candidates) {
+    if (m_textureMemory <= m_textureBudget)
+      break;
+    trace("Evict texture {}", it->first);
+    m_textureMemory -= it->second.memorySize;
+    m_textureMap.erase(it);
+  }
+}
+
+void ResourceManager::newFrame() {
+  m_frame++;
+  evictTextures();
+}
+
+void ResourceManager::uploadDecodedTextures() {
+  std::vector<DecodedImage> decoded;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::swap(decoded, m_decoded);
+  }
+  for (auto &image : decoded) {
+    upload(image);
+  }
+}
+
+void ResourceManager::requestTexture(const std::string &id) {
+  if (m_textureMap.find(id) != m_textureMap.end())
+    return;
+  if (!m_pendingTextures.insert(id).second)
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_requests.push_back(id);
+  }
+  m_requestCondition.notify_one();
+}
 
-  auto texture = std::make_shared<ngf::Texture>(img);
-  m_textureMap.insert(std::make_pair(id, TextureResource{texture, data.size()}));
+bool ResourceManager::isTextureLoaded(const std::string &id) const {
+  return m_textureMap.find(id) != m_textureMap.end();
 }
 
 void ResourceManager::loadFont(const std::string &id) {
@@ -42,10 +179,10 @@ void ResourceManager::loadFntFont(const std::string &id) {
   info("Load Fnt font {}", id);
   auto font = std::make_shared<ngf::FntFont>();
 
-  auto data = Locator<EngineSettings>::get().readBuffer(id);
+  auto data = Locator<EngineSettings>::get().readView(id, false);
   ngf::MemoryStream ms(data.data(), data.data() + data.size());
   font->load(id, ms, [](auto name) {
-    return Locator<ResourceManager>::get().getTexture(name.string());
+    return Locator<ResourceManager>::get().getLoadedTexture(name.string());
   });
 
   m_fntFontMap.insert(std::make_pair(id, font));
@@ -61,11 +198,50 @@ void ResourceManager::loadSpriteSheet(const std::string &id) {
 
 std::shared_ptr<ngf::Texture> ResourceManager::getTexture(const std::string &id) {
   auto found = m_textureMap.find(id);
-  if (found == m_textureMap.end()) {
-    load(id);
+  if (found != m_textureMap.end()) {
+    found->second.lastUsedFrame = m_frame;
+    return found->second.texture;
+  }
+
+  requestTexture(id);
+  if (!m_placeholder) {
+    uint32_t pixel{0};
+    m_placeholder = std::make_shared<ngf::Texture>();
+    m_placeholder->loadFromMemory({1, 1}, &pixel);
+  }
+  return m_placeholder;
+}
+
+std::shared_ptr<ngf::Texture> ResourceManager::getLoadedTexture(const std::string &id) {
+  auto found = m_textureMap.find(id);
+  if (found != m_textureMap.end()) {
+    found->second.lastUsedFrame = m_frame;
+    return found->second.texture;
+  }
+
+  if (m_pendingTextures.find(id) != m_pendingTextures.end()) {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      auto itRequest = std::find(m_requests.begin(), m_requests.end(), id);
+      if (itRequest != m_requests.end()) {
+        // not started yet: decode it right now
+        m_requests.erase(itRequest);
+      } else {
+        // a worker is decoding it: wait for the result
+        m_decodedCondition.wait(lock, [this, &id] { return m_decoding.find(id) == m_decoding.end(); });
+      }
+    }
+    uploadDecodedTextures();
     found = m_textureMap.find(id);
+    if (found != m_textureMap.end()) {
+      found->second.lastUsedFrame = m_frame;
+      return found->second.texture;
+    }
   }
-  return found->second.texture;
+
+  auto decoded = decode(id);
+  upload(decoded);
+  return m_textureMap.at(id).texture;
 }
 
 GGFont &ResourceManager::getFont(const std::string &id) {
@@ -19,7 +19,7 @@ void SpriteSheet::load(const std::string &name) {
 
   {
     auto jsonFilename = name + ".json";
-    auto buffer = Locator<EngineSettings>::get().readBuffer(jsonFilename);
+    auto buffer = Locator<EngineSettings>::get().readView(jsonFilename);
 
 #if 0
     std::ofstream out;
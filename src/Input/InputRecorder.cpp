@@ -0,0 +1,84 @@
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include "engge/Input/InputRecorder.hpp"
+#include "engge/System/Logger.hpp"
+
+namespace ng {
+namespace {
+template<typename T>
+void writeInteger(std::ofstream &os, T value) {
+  auto unsignedValue = static_cast<std::make_unsigned_t<T>>(value);
+  char bytes[sizeof(T)];
+  for (std::size_t i = 0; i < sizeof(T); ++i) {
+    bytes[i] = static_cast<char>((unsignedValue >> (8 * i)) & 0xFF);
+  }
+  os.write(bytes, sizeof(T));
+}
+
+void writeFloat(std::ofstream &os, float value) {
+  std::uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  writeInteger(os, bits);
+}
+
+std::uint8_t toType(const Input &key, bool isUp) {
+  auto type = static_cast<std::uint8_t>(static_cast<int>(key.metaKey) & 0x7F);
+  return isUp ? type | InputRecording::KeyUp : type;
+}
+}
+
+InputRecorder::InputRecorder(const std::filesystem::path &path, long seed)
+    : m_os(path, std::ios::binary) {
+  if (!m_os.is_open()) {
+    error("Failed to create input recording {}", path.string());
+    return;
+  }
+  m_os.write(InputRecording::Magic, sizeof(InputRecording::Magic));
+  writeInteger(m_os, InputRecording::Version);
+  writeInteger(m_os, static_cast<std::int64_t>(seed));
+  info("Recording input to {} (seed {})", path.string(), seed);
+}
+
+InputRecorder::~InputRecorder() {
+  if (m_os.is_open()) {
+    info("Input recording closed with {} frames", m_frames);
+  }
+}
+
+void InputRecorder::keyDown(const Input &key) {
+  m_keys.push_back({toType(key, false), static_cast<std::int32_t>(key.input)});
+}
+
+void InputRecorder::keyUp(const Input &key) {
+  m_keys.push_back({toType(key, true), static_cast<std::int32_t>(key.input)});
+}
+
+void InputRecorder::recordFrame(const ngf::TimeSpan &elapsed,
+                                glm::ivec2 mousePosition,
+                                bool isLeftDown,
+                                bool isRightDown) {
+  if (!m_os.is_open())
+    return;
+
+  writeFloat(m_os, elapsed.getTotalSeconds());
+  writeInteger(m_os, static_cast<std::int16_t>(mousePosition.x));
+  writeInteger(m_os, static_cast<std::int16_t>(mousePosition.y));
+  std::uint8_t buttons = 0;
+  if (isLeftDown)
+    buttons |= InputRecording::LeftButton;
+  if (isRightDown)
+    buttons |= InputRecording::RightButton;
+  writeInteger(m_os, buttons);
+
+  // more than 255 key events in a single frame are not expected, the remaining ones go to the next frame
+  auto count = std::min<std::size_t>(m_keys.size(), 255);
+  writeInteger(m_os, static_cast<std::uint8_t>(count));
+  for (std::size_t i = 0; i < count; ++i) {
+    writeInteger(m_os, m_keys[i].type);
+    writeInteger(m_os, m_keys[i].code);
+  }
+  m_keys.erase(m_keys.begin(), m_keys.begin() + count);
+  m_frames++;
+}
+} // namespace ng
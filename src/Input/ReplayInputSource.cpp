@@ -0,0 +1,114 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+#include "engge/Engine/Engine.hpp"
+#include "engge/Input/InputRecorder.hpp"
+#include "engge/Input/ReplayInputSource.hpp"
+#include "engge/System/Locator.hpp"
+#include "engge/System/Logger.hpp"
+
+namespace ng {
+namespace {
+template<typename T>
+bool readInteger(std::ifstream &is, T &value) {
+  unsigned char bytes[sizeof(T)];
+  if (!is.read(reinterpret_cast<char *>(bytes), sizeof(T)))
+    return false;
+  std::make_unsigned_t<T> unsignedValue = 0;
+  for (std::size_t i = 0; i < sizeof(T); ++i) {
+    unsignedValue |= static_cast<std::make_unsigned_t<T>>(bytes[i]) << (8 * i);
+  }
+  value = static_cast<T>(unsignedValue);
+  return true;
+}
+
+bool readFloat(std::ifstream &is, float &value) {
+  std::uint32_t bits;
+  if (!readInteger(is, bits))
+    return false;
+  std::memcpy(&value, &bits, sizeof(value));
+  return true;
+}
+}
+
+ReplayInputSource::ReplayInputSource(const std::filesystem::path &path) {
+  std::ifstream is(path, std::ios::binary);
+  if (!is.is_open()) {
+    error("Failed to open input recording {}", path.string());
+    return;
+  }
+
+  char magic[sizeof(InputRecording::Magic)];
+  std::uint32_t version = 0;
+  std::int64_t seed = 0;
+  if (!is.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), InputRecording::Magic)
+      || !readInteger(is, version) || !readInteger(is, seed)) {
+    error("Invalid input recording {}", path.string());
+    return;
+  }
+  if (version != InputRecording::Version) {
+    error("Unsupported input recording version {} in {}", version, path.string());
+    return;
+  }
+  m_seed = static_cast<long>(seed);
+
+  while (true) {
+    Frame frame;
+    std::int16_t x, y;
+    std::uint8_t count;
+    if (!readFloat(is, frame.elapsed))
+      break;
+    if (!readInteger(is, x) || !readInteger(is, y) || !readInteger(is, frame.buttons) || !readInteger(is, count)) {
+      warn("Input recording {} is truncated after {} frames", path.string(), m_frames.size());
+      break;
+    }
+    frame.mousePosition = {x, y};
+    frame.keys.reserve(count);
+    for (std::uint8_t i = 0; i < count; ++i) {
+      std::uint8_t type;
+      std::int32_t code;
+      if (!readInteger(is, type) || !readInteger(is, code))
+        break;
+      auto metaKey = static_cast<MetaKeys>(type & ~InputRecording::KeyUp);
+      frame.keys.push_back({(type & InputRecording::KeyUp) == 0, Input{metaKey, static_cast<InputConstants>(code)}});
+    }
+    if (frame.keys.size() != count) {
+      warn("Input recording {} is truncated after {} frames", path.string(), m_frames.size());
+      break;
+    }
+    m_frames.push_back(std::move(frame));
+  }
+
+  m_isValid = true;
+  info("Replaying input from {} ({} frames, seed {})", path.string(), m_frames.size(), m_seed);
+}
+
+void ReplayInputSource::update() {
+  if (isFinished()) {
+    m_elapsed = ngf::TimeSpan::seconds(0);
+    return;
+  }
+
+  const auto &frame = m_frames[m_index++];
+  m_elapsed = ngf::TimeSpan::seconds(frame.elapsed);
+  m_mousePosition = frame.mousePosition;
+  m_buttons = frame.buttons;
+  auto &engine = Locator<Engine>::get();
+  for (const auto &event : frame.keys) {
+    if (event.isDown) {
+      engine.keyDown(event.key);
+    } else {
+      engine.keyUp(event.key);
+    }
+  }
+}
+
+bool ReplayInputSource::isMouseButtonPressed(ngf::Mouse::Button button) const {
+  switch (button) {
+  case ngf::Mouse::Button::Left:return (m_buttons & InputRecording::LeftButton) != 0;
+  case ngf::Mouse::Button::Right:return (m_buttons & InputRecording::RightButton) != 0;
+  default:return false;
+  }
+}
+} // namespace ng
@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include "engge/Engine/Engine.hpp"
+#include "engge/Input/ScriptedInputSource.hpp"
+#include "engge/System/Locator.hpp"
+#include "engge/System/Logger.hpp"
+
+namespace ng {
+ScriptedInputSource::ScriptedInputSource(const std::filesystem::path &path) {
+  std::ifstream is(path);
+  if (!is.is_open()) {
+    error("Failed to open input script {}", path.string());
+    return;
+  }
+
+  std::string line;
+  int lineNumber = 0;
+  while (std::getline(is, line)) {
+    lineNumber++;
+    if (line.empty() || line[0] == '#')
+      continue;
+
+    std::istringstream ss(line);
+    Event event;
+    std::string command;
+    if (!(ss >> event.frame >> command)) {
+      warn("Invalid input script line {}: {}", lineNumber, line);
+      continue;
+    }
+
+    auto valid = true;
+    if (command == "move") {
+      event.type = EventType::Move;
+      valid = static_cast<bool>(ss >> event.position.x >> event.position.y);
+    } else if (command == "press" || command == "release") {
+      event.type = command == "press" ? EventType::Press : EventType::Release;
+      std::string button;
+      valid = static_cast<bool>(ss >> button) && (button == "left" || button == "right");
+      event.button = button == "right" ? ngf::Mouse::Button::Right : ngf::Mouse::Button::Left;
+    } else if (command == "keydown" || command == "keyup") {
+      event.type = command == "keydown" ? EventType::KeyDown : EventType::KeyUp;
+      int key = 0;
+      valid = static_cast<bool>(ss >> key);
+      event.key = static_cast<InputConstants>(key);
+    } else {
+      valid = false;
+    }
+
+    if (!valid) {
+      warn("Invalid input script line {}: {}", lineNumber, line);
+      continue;
+    }
+    m_events.push_back(event);
+  }
+
+  std::stable_sort(m_events.begin(), m_events.end(), [](const auto &e1, const auto &e2) {
+    return e1.frame < e2.frame;
+  });
+  info("Input script {} loaded with {} events", path.string(), m_events.size());
+}
+
+void ScriptedInputSource::update() {
+  while (m_index < m_events.size() && m_events[m_index].frame <= m_frame) {
+    apply(m_events[m_index]);
+    m_index++;
+  }
+  m_frame++;
+}
+
+bool ScriptedInputSource::isMouseButtonPressed(ngf::Mouse::Button button) const {
+  switch (button) {
+  case ngf::Mouse::Button::Left:return m_isLeftPressed;
+  case ngf::Mouse::Button::Right:return m_isRightPressed;
+  default:return false;
+  }
+}
+
+void ScriptedInputSource::apply(const Event &event) {
+  switch (event.type) {
+  case EventType::Move:m_mousePosition = event.position;
+    break;
+  case EventType::Press:
+  case EventType::Release: {
+    auto pressed = event.type == EventType::Press;
+    if (event.button == ngf::Mouse::Button::Right) {
+      m_isRightPressed = pressed;
+    } else {
+      m_isLeftPressed = pressed;
+    }
+    break;
+  }
+  case EventType::KeyDown:Locator<Engine>::get().keyDown({MetaKeys::None, event.key});
+    break;
+  case EventType::KeyUp:Locator<Engine>::get().keyUp({MetaKeys::None, event.key});
+    break;
+  }
+}
+} // namespace ng
@@ -1,10 +1,12 @@
 #include <cstring>
 #include "engge/Parsers/GGPackBufferStream.hpp"
 
-GGPackBufferStream::GGPackBufferStream(std::vector<char> input) : m_input(std::move(input)) {}
+GGPackBufferStream::GGPackBufferStream(std::vector<char> input) : m_input(std::move(input), false) {}
 
-void GGPackBufferStream::setBuffer(const std::vector<char> &input) {
-  m_input = input;
+GGPackBufferStream::GGPackBufferStream(ng::EntryView input) : m_input(std::move(input)) {}
+
+void GGPackBufferStream::setBuffer(ng::EntryView input) {
+  m_input = std::move(input);
   m_offset = 0;
 }
 
@@ -32,7 +34,7 @@ bool GGPackBufferStream::eof() const {
 }
 
 char GGPackBufferStream::peek() const {
-  return m_offset >= m_input.size() ? EOF : m_input.at(m_offset);
+  return m_offset >= static_cast<int>(m_input.size()) ? EOF : m_input[m_offset];
 }
 
 GGPackBufferStream &GGPackBufferStream::ignore(std::streamsize n, int delim) {
@@ -41,4 +43,4 @@ GGPackBufferStream &GGPackBufferStream::ignore(std::streamsize n, int delim) {
       return *this;
   }
   return *this;
-}
\ No newline at end of file
+}
@@ -12,8 +12,7 @@ void Lip::clear() {
 }
 
 void Lip::load(const std::string &path) {
-  auto buffer = Locator<EngineSettings>::get().readBuffer(path);
-  GGPackBufferStream input(buffer);
+  GGPackBufferStream input(Locator<EngineSettings>::get().readView(path, false));
   m_data.clear();
   m_path = path;
   std::regex re(R"(^(\d*\.?\d*)\s+(\w)$)");
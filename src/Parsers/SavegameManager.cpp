@@ -1,4 +1,6 @@
-#include <sstream>
+#include <algorithm>
+#include <fstream>
+#include <ostream>
 #include <ngf/IO/GGPackHashReader.h>
 #include <ngf/IO/MemoryStream.h>
 #include <ngf/IO/GGPackHashWriter.h>
@@ -7,6 +9,68 @@
 #include "engge/Parsers/SavegameManager.hpp"
 
 namespace ng {
+namespace {
+constexpr uint32_t InfoMagic = 0x4D47474E; // 'NGGM'
+constexpr uint32_t InfoVersion = 1;
+
+// savegames of version 2 have the size of their content in the footer, instead of the marker,
+// followed by this tag; legacy savegames always have a content of 500000 bytes
+constexpr uint32_t SizedFooterTag = 0x32474E45; // 'ENG2'
+constexpr int FooterSize = 16;
+
+// stream buffer writing in a growable vector, seeking is supported to patch the written bytes
+class BufferStreamBuf : public std::streambuf {
+public:
+  explicit BufferStreamBuf(std::vector<char> &buffer) : m_buffer(buffer) {}
+
+protected:
+  int_type overflow(int_type c) override {
+    if (traits_type::eq_int_type(c, traits_type::eof()))
+      return traits_type::not_eof(c);
+    auto ch = traits_type::to_char_type(c);
+    xsputn(&ch, 1);
+    return c;
+  }
+
+  std::streamsize xsputn(const char *s, std::streamsize n) override {
+    auto end = m_position + static_cast<size_t>(n);
+    if (end > m_buffer.size())
+      m_buffer.resize(end);
+    std::copy(s, s + n, m_buffer.begin() + m_position);
+    m_position = end;
+    return n;
+  }
+
+  pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+    if (!(which & std::ios_base::out))
+      return pos_type(off_type(-1));
+    off_type base = 0;
+    if (dir == std::ios_base::cur)
+      base = static_cast<off_type>(m_position);
+    else if (dir == std::ios_base::end)
+      base = static_cast<off_type>(m_buffer.size());
+    return seekpos(pos_type(base + off), which);
+  }
+
+  pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+    if (!(which & std::ios_base::out) || off_type(pos) < 0 || static_cast<size_t>(off_type(pos)) > m_buffer.size())
+      return pos_type(off_type(-1));
+    m_position = static_cast<size_t>(off_type(pos));
+    return pos;
+  }
+
+private:
+  std::vector<char> &m_buffer;
+  size_t m_position{0};
+};
+
+std::filesystem::path getInfoPath(const std::filesystem::path &path) {
+  std::filesystem::path infoPath(path);
+  infoPath.replace_extension(".meta");
+  return infoPath;
+}
+}
+
 static const uint8_t
     _savegameKey[] = {0xF3, 0xED, 0xA4, 0xAE, 0x2A, 0x33, 0xF8, 0xAF, 0xB4, 0xDB, 0xA2, 0xB5, 0x22, 0xA0, 0x4B, 0x9B};
 
@@ -15,6 +79,10 @@ ngf::GGPackValue SavegameManager::loadGame(const std::filesystem::path &path) {
   is.seekg(0, std::ios::end);
   auto size = static_cast<int>(is.tellg());
   is.seekg(0, std::ios::beg);
+  if (size <= FooterSize || (size % 4) != 0) {
+    warn("Invalid savegame: {}", path.string().c_str());
+    return nullptr;
+  }
   std::vector<char> data(size, '\0');
   is.read(data.data(), size);
   is.close();
@@ -22,36 +90,45 @@ ngf::GGPackValue SavegameManager::loadGame(const std::filesystem::path &path) {
   const int decSize = size / 4;
   BTEACrypto::decrypt((uint32_t *) &data[0], decSize, (uint32_t *) _savegameKey);
 
-  const int32_t hashData = *(int32_t *) &data[size - 16];
-  const int32_t hashCheck = computeHash(data, size - 16);
+  const int32_t hashData = *(int32_t *) &data[size - FooterSize];
+  const int32_t hashCheck = computeHash(data, size - FooterSize);
 
   if (hashData != hashCheck) {
     warn("Invalid savegame: {}", path.string().c_str());
     return nullptr;
   }
 
-  ngf::MemoryStream ms(data.data(), data.data() + data.size());
+  // legacy savegames: the content is padded with zeros
+  auto contentSize = size - FooterSize;
+  if (*(uint32_t *) &data[size - 4] == SizedFooterTag) {
+    contentSize = std::min(contentSize, *(int32_t *) &data[size - 8]);
+  }
+
+  ngf::MemoryStream ms(data.data(), data.data() + contentSize);
   return ngf::GGPackHashReader::read(ms);
 }
 
 void SavegameManager::saveGame(const std::filesystem::path &path, const ngf::GGPackValue &saveGameHash) {
-  // save hash
-  std::stringstream o;
+  // save hash directly in the buffer to encode
+  std::vector<char> buf;
+  buf.reserve(64 * 1024);
+  BufferStreamBuf streamBuf(buf);
+  std::ostream o(&streamBuf);
   ngf::GGPackHashWriter::write(saveGameHash, o);
+  o.flush();
 
-  // encode data
-  const int fullSize = 500000;
-  const int fullSizeAndFooter = fullSize + 16;
-  const int32_t marker = 8 - ((fullSize + 9) % 8);
+  // encode data: the content is padded to a multiple of 8 bytes
+  const auto contentSize = static_cast<int32_t>(buf.size());
+  const int fullSize = (contentSize + 7) & ~7;
+  const int fullSizeAndFooter = fullSize + FooterSize;
+  buf.resize(fullSizeAndFooter, '\0');
 
-  std::vector<char> buf(fullSizeAndFooter);
-  o.read(buf.data(), fullSize);
-
-  // write at the end 16 bytes: hashdata (4 bytes) + savetime (4 bytes) + marker (8 bytes)
+  // write at the end 16 bytes: hashdata (4 bytes) + savetime (4 bytes) + content size (4 bytes) + tag (4 bytes)
   const int32_t hashData = computeHash(buf, fullSize);
   *(int32_t *) &buf[fullSize] = hashData;
   *(int32_t *) &buf[fullSize + 4] = saveGameHash["savetime"].getInt();
-  memset(&buf[fullSize + 8], marker, 8);
+  *(int32_t *) &buf[fullSize + 8] = contentSize;
+  *(uint32_t *) &buf[fullSize + 12] = SizedFooterTag;
 
   // then encode data
   const int decSize = fullSizeAndFooter / 4;
@@ -74,4 +151,58 @@ int32_t SavegameManager::computeHash(const std::vector<char> &data, int32_t size
   } while (v10 < size);
   return v11;
 }
+
+SavegameInfo SavegameManager::getInfo(const ngf::GGPackValue &hash) {
+  SavegameInfo info;
+  info.easyMode = hash["easy_mode"].getInt() != 0;
+  info.savetime = hash["savetime"].getInt();
+  info.gameTime = hash["gameTime"].getDouble();
+  return info;
+}
+
+std::optional<SavegameInfo> SavegameManager::loadInfo(const std::filesystem::path &path) {
+  auto infoPath = getInfoPath(path);
+  std::error_code ec;
+  auto infoTime = std::filesystem::last_write_time(infoPath, ec);
+  if (ec)
+    return std::nullopt;
+
+  // the savegame has been written after its sidecar, by an older version for example
+  auto saveTime = std::filesystem::last_write_time(path, ec);
+  if (ec || saveTime > infoTime)
+    return std::nullopt;
+
+  std::ifstream is(infoPath, std::ifstream::binary);
+  uint32_t magic = 0, version = 0;
+  int32_t savetime = 0;
+  double gameTime = 0;
+  uint8_t easyMode = 0;
+  is.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+  is.read(reinterpret_cast<char *>(&version), sizeof(version));
+  is.read(reinterpret_cast<char *>(&savetime), sizeof(savetime));
+  is.read(reinterpret_cast<char *>(&gameTime), sizeof(gameTime));
+  is.read(reinterpret_cast<char *>(&easyMode), sizeof(easyMode));
+  if (!is || magic != InfoMagic || version != InfoVersion)
+    return std::nullopt;
+
+  SavegameInfo info;
+  info.savetime = savetime;
+  info.gameTime = gameTime;
+  info.easyMode = easyMode != 0;
+  return info;
+}
+
+void SavegameManager::saveInfo(const std::filesystem::path &path, const SavegameInfo &info) {
+  std::ofstream os(getInfoPath(path), std::ofstream::binary);
+  if (!os.is_open()) {
+    warn("Cannot write savegame info: {}", path.string().c_str());
+    return;
+  }
+  uint8_t easyMode = info.easyMode ? 1 : 0;
+  os.write(reinterpret_cast<const char *>(&InfoMagic), sizeof(InfoMagic));
+  os.write(reinterpret_cast<const char *>(&InfoVersion), sizeof(InfoVersion));
+  os.write(reinterpret_cast<const char *>(&info.savetime), sizeof(info.savetime));
+  os.write(reinterpret_cast<const char *>(&info.gameTime), sizeof(info.gameTime));
+  os.write(reinterpret_cast<const char *>(&easyMode), sizeof(easyMode));
+}
 }
@@ -0,0 +1,97 @@
+#include <ngf/Graphics/Image.h>
+#include <ngf/System/StopWatch.h>
+#include "engge/System/Logger.hpp"
+#include "engge/Parsers/SavegameManager.hpp"
+#include "engge/Parsers/SavegameWriter.hpp"
+
+namespace ng {
+SavegameWriter::SavegameWriter() {
+  m_worker = std::thread([this] { writeLoop(); });
+}
+
+SavegameWriter::~SavegameWriter() {
+  // the pending savegames are written before leaving
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopping = true;
+  }
+  m_jobCondition.notify_all();
+  m_worker.join();
+}
+
+void SavegameWriter::save(std::filesystem::path path,
+                          ngf::GGPackValue hash,
+                          std::unique_ptr<ngf::Image> screenshot,
+                          Callback onSaved) {
+  Job job;
+  job.path = std::move(path);
+  job.hash = std::move(hash);
+  job.screenshot = std::move(screenshot);
+  job.onSaved = std::move(onSaved);
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_jobs.push_back(std::move(job));
+  }
+  m_jobCondition.notify_one();
+}
+
+void SavegameWriter::update() {
+  std::vector<Callback> done;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_done.empty())
+      return;
+    std::swap(done, m_done);
+  }
+  for (auto &onSaved : done) {
+    if (onSaved)
+      onSaved();
+  }
+}
+
+void SavegameWriter::wait() {
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_doneCondition.wait(lock, [this] { return m_jobs.empty() && !m_writing; });
+}
+
+void SavegameWriter::write(Job &job) {
+  ngf::StopWatch watch;
+  if (job.screenshot) {
+    std::filesystem::path screenshotPath(job.path);
+    screenshotPath.replace_extension(".png");
+    job.screenshot->saveToFile(screenshotPath.string());
+  }
+  SavegameManager::saveGame(job.path, job.hash);
+  // written after the savegame, so the load screen knows it's up to date
+  SavegameManager::saveInfo(job.path, SavegameManager::getInfo(job.hash));
+  info("Savegame {} written in {} s", job.path.string(), watch.getElapsedTime().getTotalSeconds());
+}
+
+void SavegameWriter::writeLoop() {
+  while (true) {
+    Job job;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_jobCondition.wait(lock, [this] { return m_stopping || !m_jobs.empty(); });
+      if (m_jobs.empty())
+        return;
+      job = std::move(m_jobs.front());
+      m_jobs.pop_front();
+      m_writing = true;
+    }
+
+    try {
+      write(job);
+    } catch (const std::exception &e) {
+      error("Failed to write savegame {}: {}", job.path.string(), e.what());
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_writing = false;
+      m_done.push_back(std::move(job.onSaved));
+    }
+    m_doneCondition.notify_all();
+  }
+}
+}
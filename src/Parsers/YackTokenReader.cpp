@@ -59,7 +59,7 @@ Token *YackTokenReader::Iterator::operator->() {
 }
 
 void YackTokenReader::load(const std::string &path) {
-  auto buffer = Locator<EngineSettings>::get().readBuffer(path);
+  auto buffer = Locator<EngineSettings>::get().readView(path);
 
 #if 0
   std::ofstream o;
@@ -68,7 +68,7 @@ void YackTokenReader::load(const std::string &path) {
   o.close();
 #endif
 
-  m_stream.setBuffer(buffer);
+  m_stream.setBuffer(std::move(buffer));
 }
 
 YackTokenReader::iterator YackTokenReader::begin() {
@@ -430,11 +430,14 @@ std::unique_ptr<Room> Room::define(HSQOBJECT roomTable, const char *name) {
 Room::Room(HSQOBJECT roomTable)
     : m_pImpl(std::make_unique<Impl>(roomTable)) {
   m_id = Locator<EntityManager>::get().getRoomId();
+  Locator<EntityManager>::get().addRoom(this);
   m_pImpl->setRoom(this);
   ScriptEngine::set(this, "_id", getId());
 }
 
-Room::~Room() = default;
+Room::~Room() {
+  Locator<EntityManager>::get().removeRoom(this);
+}
 
 void Room::setName(const std::string &name) { m_pImpl->_name = name; }
 std::string Room::getName() const { return m_pImpl->_name; }
@@ -575,7 +578,7 @@ Object &Room::createObject(const std::string &image) {
 
   const std::vector<std::string> anims{name};
   auto object = std::make_unique<Object>();
-  auto texture = Locator<ResourceManager>::get().getTexture(name + ".png");
+  auto texture = Locator<ResourceManager>::get().getLoadedTexture(name + ".png");
 
   Animation anim;
   auto size = texture->getSize();
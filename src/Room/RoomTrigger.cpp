@@ -4,6 +4,7 @@
 #include <engge/System/Logger.hpp>
 #include <engge/Entities/Object.hpp>
 #include <engge/Scripting/ScriptEngine.hpp>
+#include <engge/Engine/ThreadPool.hpp>
 #include <squirrel.h>
 
 namespace ng {
@@ -54,8 +55,8 @@ HSQUIRRELVM RoomTrigger::createThread() {
   HSQOBJECT thread_obj{};
   sq_resetobject(&thread_obj);
 
-  HSQUIRRELVM thread = sq_newthread(m_vm, 1024);
-  if (SQ_FAILED(sq_getstackobj(m_vm, -1, &thread_obj))) {
+  HSQUIRRELVM thread = m_engine.getThreadPool().acquire(m_vm);
+  if (!thread || SQ_FAILED(sq_getstackobj(m_vm, -1, &thread_obj))) {
     error("Couldn't get coroutine thread from stack");
     return {};
   }
@@ -1,6 +1,7 @@
 #pragma once
 #include "../Util/Util.hpp"
 #include "engge/Engine/Engine.hpp"
+#include "engge/Engine/RoomPrefetcher.hpp"
 #include "engge/Parsers/Lip.hpp"
 #include <squirrel.h>
 #include <ngf/Math/PathFinding/Walkbox.h>
@@ -821,6 +822,7 @@ private:
         pos.x += usePos.x;
         pos.y += usePos.y;
         pActor->walkTo(pos, toFacing(pObject->getUseDirection()));
+        g_pEngine->getRoomPrefetcher().onWalkTo(*pObject);
         return 0;
       }
 
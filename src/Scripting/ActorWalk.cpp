@@ -1,5 +1,6 @@
 #include "ActorWalk.hpp"
 #include <engge/Engine/Engine.hpp>
+#include <engge/Engine/RoomPrefetcher.hpp>
 #include <engge/Entities/Actor.hpp>
 #include <engge/Entities/Costume.hpp>
 #include <engge/Entities/Entity.hpp>
@@ -17,6 +18,7 @@ ActorWalk::ActorWalk(Engine &engine, Actor &actor, Entity *pEntity, Sentence *pS
   auto facing = getFacing(pEntity);
   auto destination = pActor ? pos : pos + usePos;
   m_path = m_actor.walkTo(destination, facing);
+  m_engine.getRoomPrefetcher().onWalkTo(*pEntity);
   int useDist = 0;
   ScriptEngine::rawGet(pEntity, "useDist", useDist);
   useDist = std::max(useDist, 4);
@@ -3,6 +3,12 @@
 #include "DefaultScriptExecute.hpp"
 
 namespace ng {
+DefaultScriptExecute::~DefaultScriptExecute() {
+  for (auto &closure : m_closures) {
+    sq_release(m_vm, &closure.second);
+  }
+}
+
 void DefaultScriptExecute::execute(const std::string &code) {
   sq_resetobject(&m_result);
   auto top = sq_gettop(m_vm);
@@ -22,12 +28,60 @@ void DefaultScriptExecute::execute(const std::string &code) {
   sq_settop(m_vm, top);
 }
 
-bool DefaultScriptExecute::executeCondition(const std::string &code) {
+bool DefaultScriptExecute::getClosure(const std::string &code, HSQOBJECT &closure) {
+  auto it = m_closureMap.find(code);
+  if (it != m_closureMap.end()) {
+    m_closures.splice(m_closures.begin(), m_closures, it->second);
+    closure = it->second->second;
+    return true;
+  }
+
   std::string c;
   c.append("return ");
   c.append(code);
 
-  execute(c);
+  auto top = sq_gettop(m_vm);
+  if (SQ_FAILED(sq_compilebuffer(m_vm, c.data(), c.size(), _SC("_DefaultScriptExecute"), SQTrue))) {
+    error("Error executing code {}", c);
+    sq_settop(m_vm, top);
+    return false;
+  }
+  sq_resetobject(&closure);
+  sq_getstackobj(m_vm, -1, &closure);
+  sq_addref(m_vm, &closure);
+  sq_settop(m_vm, top);
+
+  if (m_closures.size() >= MaxClosures) {
+    auto &last = m_closures.back();
+    sq_release(m_vm, &last.second);
+    m_closureMap.erase(last.first);
+    m_closures.pop_back();
+  }
+  m_closures.emplace_front(code, closure);
+  m_closureMap[code] = m_closures.begin();
+  return true;
+}
+
+void DefaultScriptExecute::call(const std::string &code, const HSQOBJECT &closure) {
+  sq_resetobject(&m_result);
+  auto top = sq_gettop(m_vm);
+  sq_pushobject(m_vm, closure);
+  sq_pushroottable(m_vm);
+  if (SQ_FAILED(sq_call(m_vm, 1, SQTrue, SQTrue))) {
+    error("Error calling code {}", code);
+    sq_settop(m_vm, top);
+    return;
+  }
+  sq_getstackobj(m_vm, -1, &m_result);
+  sq_settop(m_vm, top);
+}
+
+bool DefaultScriptExecute::executeCondition(const std::string &code) {
+  HSQOBJECT closure;
+  if (!getClosure(code, closure))
+    return false;
+
+  call(code, closure);
   if (m_result._type == OT_BOOL) {
     trace("{} returns {}", code, sq_objtobool(&m_result));
     return sq_objtobool(&m_result);
@@ -43,11 +97,13 @@ bool DefaultScriptExecute::executeCondition(const std::string &code) {
 }
 
 std::string DefaultScriptExecute::executeDollar(const std::string &code) {
-  std::string c;
-  c.append("return ");
-  c.append(code);
+  HSQOBJECT closure;
+  if (!getClosure(code, closure)) {
+    error("Error getting result {}", code);
+    return "";
+  }
 
-  execute(c);
+  call(code, closure);
 // get the result
   if (m_result._type != OT_STRING) {
     error("Error getting result {}", code);
@@ -1,4 +1,6 @@
 #pragma once
+#include <list>
+#include <unordered_map>
 #include <squirrel.h>
 #include "engge/Scripting/ScriptExecute.hpp"
 
@@ -6,6 +8,7 @@ namespace ng {
 class DefaultScriptExecute final : public ScriptExecute {
 public:
   explicit DefaultScriptExecute(HSQUIRRELVM vm) : m_vm(vm) {}
+  ~DefaultScriptExecute() override;
 
 public:
   void execute(const std::string &code) override;
@@ -14,7 +17,17 @@ public:
   SoundDefinition *getSoundDefinition(const std::string &name) override;
 
 private:
+  bool getClosure(const std::string &code, HSQOBJECT &closure);
+  void call(const std::string &code, const HSQOBJECT &closure);
+
+private:
+  using Closures = std::list<std::pair<std::string, HSQOBJECT>>;
+  static constexpr size_t MaxClosures = 256;
+
   HSQUIRRELVM m_vm{};
   HSQOBJECT m_result{};
+  // compiled conditions and dollar expressions, the most recently used first
+  Closures m_closures;
+  std::unordered_map<std::string, Closures::iterator> m_closureMap;
 };
 }
@@ -257,13 +257,7 @@ private:
     filename = name;
     checkLanguage(filename);
     auto &settings = Locator<EngineSettings>::get();
-    std::vector<char> buffer;
-    if (settings.hasEntry(filename)) {
-      buffer = settings.readBuffer(filename);
-    } else {
-      buffer = settings.readBuffer(name);
-    }
-    GGPackBufferStream input(buffer);
+    GGPackBufferStream input(settings.readView(settings.hasEntry(filename) ? filename : std::string(name), false));
     std::string line;
 
     sq_newarray(v, 0);
@@ -494,9 +488,7 @@ private:
     }
     if (sq_gettype(v, 2) == OT_NULL) {
       // set seed with time
-      time_t t;
-      auto seed = static_cast<long>(time(&t));
-      Locator<RandomNumberGenerator>::get().setSeed(seed);
+      Locator<RandomNumberGenerator>::get().setTimeSeed();
       return 0;
     }
     SQInteger seed;
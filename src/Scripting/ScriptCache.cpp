@@ -0,0 +1,377 @@
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <vector>
+#include "engge/System/Logger.hpp"
+#include "ScriptCache.hpp"
+#include "BnutPass.hpp"
+
+namespace {
+constexpr uint32_t CacheMagic = 0x43474E45; // 'ENGC'
+constexpr uint32_t CacheVersion = 1;
+constexpr size_t BnutPassSize = sizeof(ng::_bnutPass);
+
+class Writer {
+public:
+  template<typename T>
+  void write(const T &value) {
+    write(&value, sizeof(T));
+  }
+
+  void write(const void *data, size_t size) {
+    const auto *p = static_cast<const char *>(data);
+    m_data.insert(m_data.end(), p, p + size);
+  }
+
+  static SQInteger writeFunc(SQUserPointer up, SQUserPointer data, SQInteger size) {
+    static_cast<Writer *>(up)->write(data, static_cast<size_t>(size));
+    return size;
+  }
+
+  [[nodiscard]] const std::vector<char> &getData() const { return m_data; }
+
+private:
+  std::vector<char> m_data;
+};
+
+class Reader {
+public:
+  Reader(const char *data, size_t size) : m_data(data), m_size(size) {}
+
+  template<typename T>
+  bool read(T &value) {
+    return read(&value, sizeof(T));
+  }
+
+  bool read(void *data, size_t size) {
+    if (m_size - m_position < size)
+      return false;
+    std::memcpy(data, m_data + m_position, size);
+    m_position += size;
+    return true;
+  }
+
+  bool skip(size_t size) {
+    if (m_size - m_position < size)
+      return false;
+    m_position += size;
+    return true;
+  }
+
+  [[nodiscard]] const char *getCurrent() const { return m_data + m_position; }
+
+  static SQInteger readFunc(SQUserPointer up, SQUserPointer data, SQInteger size) {
+    auto *pReader = static_cast<Reader *>(up);
+    if (!pReader->read(data, static_cast<size_t>(size)))
+      return -1;
+    return size;
+  }
+
+private:
+  const char *m_data;
+  size_t m_size;
+  size_t m_position{0};
+};
+
+uint64_t hash(uint64_t seed, const char *data, size_t size) {
+  // FNV-1a
+  uint64_t h = seed;
+  for (size_t i = 0; i < size; i++) {
+    h ^= static_cast<unsigned char>(data[i]);
+    h *= 0x100000001b3ULL;
+  }
+  return h;
+}
+
+bool writeValue(HSQUIRRELVM v, SQInteger index, Writer &writer) {
+  auto type = sq_gettype(v, index);
+  writer.write(static_cast<uint32_t>(type));
+  switch (type) {
+  case OT_INTEGER: {
+    SQInteger value = 0;
+    sq_getinteger(v, index, &value);
+    writer.write(static_cast<int64_t>(value));
+    return true;
+  }
+  case OT_FLOAT: {
+    SQFloat value = 0;
+    sq_getfloat(v, index, &value);
+    writer.write(static_cast<double>(value));
+    return true;
+  }
+  case OT_BOOL: {
+    SQBool value = SQFalse;
+    sq_getbool(v, index, &value);
+    writer.write(static_cast<uint8_t>(value ? 1 : 0));
+    return true;
+  }
+  case OT_STRING: {
+    const SQChar *value = nullptr;
+    sq_getstring(v, index, &value);
+    auto length = static_cast<uint32_t>(sq_getsize(v, index));
+    writer.write(length);
+    writer.write(value, length);
+    return true;
+  }
+  case OT_TABLE: {
+    auto table = index < 0 ? sq_gettop(v) + index + 1 : index;
+    writer.write(static_cast<uint32_t>(sq_getsize(v, table)));
+    sq_pushnull(v);
+    while (SQ_SUCCEEDED(sq_next(v, table))) {
+      auto success = writeValue(v, -2, writer) && writeValue(v, -1, writer);
+      sq_pop(v, 2);
+      if (!success) {
+        sq_pop(v, 1);
+        return false;
+      }
+    }
+    sq_pop(v, 1);
+    return true;
+  }
+  default:return false;
+  }
+}
+
+bool pushValue(HSQUIRRELVM v, Reader &reader) {
+  uint32_t type = 0;
+  if (!reader.read(type))
+    return false;
+  switch (static_cast<SQObjectType>(type)) {
+  case OT_INTEGER: {
+    int64_t value = 0;
+    if (!reader.read(value))
+      return false;
+    sq_pushinteger(v, static_cast<SQInteger>(value));
+    return true;
+  }
+  case OT_FLOAT: {
+    double value = 0;
+    if (!reader.read(value))
+      return false;
+    sq_pushfloat(v, static_cast<SQFloat>(value));
+    return true;
+  }
+  case OT_BOOL: {
+    uint8_t value = 0;
+    if (!reader.read(value))
+      return false;
+    sq_pushbool(v, value ? SQTrue : SQFalse);
+    return true;
+  }
+  case OT_STRING: {
+    uint32_t length = 0;
+    if (!reader.read(length))
+      return false;
+    std::string value(length, '\0');
+    if (!reader.read(value.data(), length))
+      return false;
+    sq_pushstring(v, value.data(), static_cast<SQInteger>(length));
+    return true;
+  }
+  case OT_TABLE: {
+    uint32_t count = 0;
+    if (!reader.read(count))
+      return false;
+    sq_newtable(v);
+    for (uint32_t i = 0; i < count; i++) {
+      if (!pushValue(v, reader))
+        return false;
+      if (!pushValue(v, reader))
+        return false;
+      sq_newslot(v, -3, SQFalse);
+    }
+    return true;
+  }
+  default:return false;
+  }
+}
+}
+
+namespace ng {
+ConstantsSnapshot::ConstantsSnapshot(HSQUIRRELVM v) : m_vm(v) {
+  sq_pushconsttable(v);
+  sq_pushnull(v);
+  while (SQ_SUCCEEDED(sq_next(v, -2))) {
+    const SQChar *name = nullptr;
+    if (SQ_SUCCEEDED(sq_getstring(v, -2, &name))) {
+      HSQOBJECT value;
+      sq_resetobject(&value);
+      sq_getstackobj(v, -1, &value);
+      sq_addref(v, &value);
+      m_constants.emplace(name, value);
+    }
+    sq_pop(v, 2);
+  }
+  sq_pop(v, 2);
+}
+
+ConstantsSnapshot::~ConstantsSnapshot() {
+  for (auto &constant : m_constants) {
+    sq_release(m_vm, &constant.second);
+  }
+}
+
+bool ConstantsSnapshot::contains(const std::string &name, const HSQOBJECT &value) const {
+  auto it = m_constants.find(name);
+  if (it == m_constants.end())
+    return false;
+  return it->second._type == value._type && it->second._unVal.raw == value._unVal.raw;
+}
+
+uint64_t ConstantsSnapshot::computeHash(uint64_t seed) const {
+  std::vector<const std::pair<const std::string, HSQOBJECT> *> constants;
+  constants.reserve(m_constants.size());
+  for (const auto &constant : m_constants) {
+    constants.push_back(&constant);
+  }
+  std::sort(constants.begin(), constants.end(), [](const auto *pLeft, const auto *pRight) {
+    return pLeft->first < pRight->first;
+  });
+
+  Writer writer;
+  for (const auto *pConstant : constants) {
+    writer.write(pConstant->first.data(), pConstant->first.size() + 1);
+    sq_pushobject(m_vm, pConstant->second);
+    // a value which can't be written is only hashed with its type
+    writeValue(m_vm, -1, writer);
+    sq_pop(m_vm, 1);
+  }
+  return hash(seed, writer.getData().data(), writer.getData().size());
+}
+
+ScriptCache::ScriptCache(std::filesystem::path directory, HSQUIRRELVM v)
+    : m_directory(std::move(directory)) {
+  ConstantsSnapshot constants(v);
+  m_chain = constants.computeHash(0xcbf29ce484222325ULL ^ (CacheVersion << 8u) ^ sizeof(SQInteger));
+}
+
+std::filesystem::path ScriptCache::getPath(const std::string &name) const {
+  return m_directory / (std::filesystem::path(name).stem().string() + ".nutc");
+}
+
+uint64_t ScriptCache::computeKey(const char *data, size_t size) {
+  m_chain = hash(m_chain, data, size);
+  return m_chain;
+}
+
+bool ScriptCache::load(HSQUIRRELVM v, const std::string &name, uint64_t key) {
+  std::ifstream is(getPath(name), std::ios::binary);
+  if (!is.is_open())
+    return false;
+
+  std::vector<char> data((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+  Reader reader(data.data(), data.size());
+  uint32_t magic = 0, version = 0, constantsSize = 0;
+  uint64_t fileKey = 0;
+  if (!reader.read(magic) || !reader.read(version) || !reader.read(fileKey) || !reader.read(constantsSize))
+    return false;
+  if (magic != CacheMagic || version != CacheVersion || fileKey != key)
+    return false;
+
+  const auto *pConstants = reader.getCurrent();
+  if (!reader.skip(constantsSize))
+    return false;
+
+  auto top = sq_gettop(v);
+  if (SQ_FAILED(sq_readclosure(v, Reader::readFunc, &reader))) {
+    warn("Invalid cached script {}", name);
+    sq_settop(v, top);
+    return false;
+  }
+
+  // declare the constants of the script, as the compiler would do
+  Reader constantsReader(pConstants, constantsSize);
+  uint32_t count = 0;
+  constantsReader.read(count);
+  sq_pushconsttable(v);
+  for (uint32_t i = 0; i < count; i++) {
+    if (!pushValue(v, constantsReader) || !pushValue(v, constantsReader)) {
+      warn("Invalid cached constants for script {}", name);
+      sq_settop(v, top);
+      return false;
+    }
+    sq_newslot(v, -3, SQFalse);
+  }
+  sq_pop(v, 1);
+  trace("Script {} loaded from cache", name);
+  return true;
+}
+
+void ScriptCache::save(HSQUIRRELVM v, const std::string &name, uint64_t key, const ConstantsSnapshot &constants) {
+  Writer closure;
+  if (SQ_FAILED(sq_writeclosure(v, Writer::writeFunc, &closure))) {
+    warn("Failed to serialize script {}", name);
+    return;
+  }
+
+  // find the constants declared by the script
+  Writer constantsWriter;
+  uint32_t count = 0;
+  Writer entries;
+  auto top = sq_gettop(v);
+  sq_pushconsttable(v);
+  sq_pushnull(v);
+  while (SQ_SUCCEEDED(sq_next(v, -2))) {
+    const SQChar *constantName = nullptr;
+    HSQOBJECT value;
+    sq_resetobject(&value);
+    sq_getstackobj(v, -1, &value);
+    if (SQ_SUCCEEDED(sq_getstring(v, -2, &constantName)) && !constants.contains(constantName, value)) {
+      if (!writeValue(v, -2, entries) || !writeValue(v, -1, entries)) {
+        // this constant can't be restored, the script will be compiled each time
+        trace("Script {} can't be cached, constant {} is not supported", name, constantName);
+        sq_settop(v, top);
+        return;
+      }
+      count++;
+    }
+    sq_pop(v, 2);
+  }
+  sq_settop(v, top);
+  constantsWriter.write(count);
+  constantsWriter.write(entries.getData().data(), entries.getData().size());
+
+  std::error_code ec;
+  std::filesystem::create_directories(m_directory, ec);
+  std::ofstream os(getPath(name), std::ios::binary | std::ios::trunc);
+  if (!os.is_open()) {
+    warn("Failed to write cached script {}", name);
+    return;
+  }
+  auto constantsSize = static_cast<uint32_t>(constantsWriter.getData().size());
+  os.write(reinterpret_cast<const char *>(&CacheMagic), sizeof(CacheMagic));
+  os.write(reinterpret_cast<const char *>(&CacheVersion), sizeof(CacheVersion));
+  os.write(reinterpret_cast<const char *>(&key), sizeof(key));
+  os.write(reinterpret_cast<const char *>(&constantsSize), sizeof(constantsSize));
+  os.write(constantsWriter.getData().data(), constantsSize);
+  os.write(closure.getData().data(), static_cast<std::streamsize>(closure.getData().size()));
+}
+
+void decodeBnut(char *data, size_t size) {
+  if (size == 0)
+    return;
+
+  // the key is applied in contiguous runs, from the cursor to its end and then from its start,
+  // each run is xored 8 bytes at a time
+  size_t cursor = (size - 1) & 0xff;
+  size_t position = 0;
+  while (position < size) {
+    auto length = std::min(size - position, BnutPassSize - cursor);
+    auto *pData = data + position;
+    const auto *pKey = _bnutPass + cursor;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+      uint64_t d, k;
+      std::memcpy(&d, pData + i, sizeof(d));
+      std::memcpy(&k, pKey + i, sizeof(k));
+      d ^= k;
+      std::memcpy(pData + i, &d, sizeof(d));
+    }
+    for (; i < length; i++) {
+      pData[i] = static_cast<char>(pData[i] ^ pKey[i]);
+    }
+    position += length;
+    cursor = 0;
+  }
+}
+} // namespace ng
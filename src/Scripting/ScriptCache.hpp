@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <squirrel.h>
+
+namespace ng {
+/// @brief Snapshot of the constants declared in the VM, used to find the constants declared by a script.
+class ConstantsSnapshot {
+public:
+  explicit ConstantsSnapshot(HSQUIRRELVM v);
+  ~ConstantsSnapshot();
+  ConstantsSnapshot(const ConstantsSnapshot &) = delete;
+  ConstantsSnapshot &operator=(const ConstantsSnapshot &) = delete;
+
+  [[nodiscard]] bool contains(const std::string &name, const HSQOBJECT &value) const;
+
+  /// @brief Hashes the names and the values of the constants, in name order.
+  [[nodiscard]] uint64_t computeHash(uint64_t seed) const;
+
+private:
+  HSQUIRRELVM m_vm{};
+  std::unordered_map<std::string, HSQOBJECT> m_constants;
+};
+
+/// @brief Persistent cache of the compiled scripts.
+/// @details Each script is stored with a key computed from its content chained with the keys of the
+/// scripts executed before it, because the compiler inlines the constants declared by previous scripts.
+/// Loading bytecode doesn't declare the constants of a script, so they are stored with the bytecode and
+/// declared again when the script is loaded. The chain starts with the constants declared by the engine.
+class ScriptCache {
+public:
+  /// @brief Creates a cache whose keys are seeded with the constants currently declared in the VM.
+  ScriptCache(std::filesystem::path directory, HSQUIRRELVM v);
+
+  /// @brief Computes the key of a script content and chains it for the next scripts.
+  uint64_t computeKey(const char *data, size_t size);
+
+  /// @brief Loads the compiled script and pushes it on the stack if its key matches.
+  /// \return true if the script has been loaded, false otherwise and nothing is pushed.
+  bool load(HSQUIRRELVM v, const std::string &name, uint64_t key);
+
+  /// @brief Saves the compiled script which is on top of the stack.
+  /// \param constants: constants declared before compiling the script.
+  void save(HSQUIRRELVM v, const std::string &name, uint64_t key, const ConstantsSnapshot &constants);
+
+private:
+  [[nodiscard]] std::filesystem::path getPath(const std::string &name) const;
+
+private:
+  std::filesystem::path m_directory;
+  uint64_t m_chain{0};
+};
+
+/// @brief Decodes a .bnut content in place.
+void decodeBnut(char *data, size_t size);
+} // namespace ng
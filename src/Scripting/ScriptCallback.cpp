@@ -0,0 +1,54 @@
+#include "engge/Scripting/ScriptCallback.hpp"
+
+namespace ng {
+ScriptCallback::ScriptCallback(const char *name) : m_name(name) {
+  sq_resetobject(&m_table);
+  sq_resetobject(&m_closure);
+}
+
+ScriptCallback::~ScriptCallback() {
+  release();
+}
+
+bool ScriptCallback::resolve(HSQUIRRELVM v, SQInteger index) {
+  HSQOBJECT table;
+  sq_getstackobj(v, index, &table);
+  if (!sq_istable(table)) {
+    release();
+    return false;
+  }
+
+  auto version = ScriptEngine::getVersion(table);
+  if (sq_istable(m_table) && m_table._unVal.pTable == table._unVal.pTable && m_version == version)
+    return !sq_isnull(m_closure);
+
+  release();
+  m_table = table;
+  m_version = version;
+  sq_addref(v, &m_table);
+
+  auto top = sq_gettop(v);
+  sq_pushobject(v, table);
+  sq_pushstring(v, m_name, -1);
+  if (SQ_SUCCEEDED(sq_rawget(v, -2))) {
+    auto type = sq_gettype(v, -1);
+    if (type == OT_CLOSURE || type == OT_NATIVECLOSURE) {
+      sq_getstackobj(v, -1, &m_closure);
+      sq_addref(v, &m_closure);
+    }
+  }
+  sq_settop(v, top);
+  return !sq_isnull(m_closure);
+}
+
+void ScriptCallback::release() {
+  // the handles can outlive the VM when the application quits
+  auto v = ScriptEngine::getVm();
+  if (v) {
+    sq_release(v, &m_closure);
+    sq_release(v, &m_table);
+  }
+  sq_resetobject(&m_closure);
+  sq_resetobject(&m_table);
+}
+}
@@ -24,7 +24,7 @@
 #include "SoundPack.hpp"
 #include "DefaultScriptExecute.hpp"
 #include "DefaultVerbExecute.hpp"
-#include "BnutPass.hpp"
+#include "ScriptCache.hpp"
 #include "engge/Input/InputConstants.hpp"
 #include "engge/Engine/InputStateConstants.hpp"
 
@@ -250,6 +250,7 @@ ScriptEngine::ScriptEngine() {
 
 ScriptEngine::~ScriptEngine() {
   sq_close(m_vm);
+  m_vm = nullptr;
 }
 
 void ScriptEngine::setEngine(Engine &engine) {
@@ -294,33 +295,51 @@ void ScriptEngine::errorHandler(HSQUIRRELVM v, const SQChar *desc, const SQChar
   for (auto &callback : m_errorCallbacks) {
     callback(v, os.str().data());
   }
-  error(os.str());
+  error("{}", os.str());
+}
+
+namespace {
+// the buffer is reused by the caller, it only grows for the longest message
+const SQChar *formatMessage(std::vector<SQChar> &buf, const SQChar *s, va_list vl) {
+  va_list copy;
+  va_copy(copy, vl);
+  auto size = vsnprintf(buf.data(), buf.size(), s, copy);
+  va_end(copy);
+  if (size >= 0 && static_cast<size_t>(size) >= buf.size()) {
+    buf.resize(static_cast<size_t>(size) + 1);
+    vsnprintf(buf.data(), buf.size(), s, vl);
+  }
+  return buf.data();
+}
 }
 
 void ScriptEngine::errorfunc(HSQUIRRELVM v, const SQChar *s, ...) {
-  SQChar buf[1024];
+  thread_local std::vector<SQChar> errorBuffer(1024);
   va_list vl;
   va_start(vl, s);
-  vsprintf(buf, s, vl);
+  auto buf = formatMessage(errorBuffer, s, vl);
   va_end(vl);
 
   for (auto &callback : m_errorCallbacks) {
     callback(v, buf);
   }
-  error(buf);
+  error("{}", buf);
 }
 
 void ScriptEngine::printfunc(HSQUIRRELVM v, const SQChar *s, ...) {
-  std::vector<SQChar> buf(1024 * 1024);
+  if (m_printCallbacks.empty() && !Logger::isActive(spdlog::level::trace))
+    return;
+
+  thread_local std::vector<SQChar> printBuffer(1024);
   va_list vl;
   va_start(vl, s);
-  vsnprintf(buf.data(), buf.size(), s, vl);
+  auto buf = formatMessage(printBuffer, s, vl);
   va_end(vl);
 
   for (auto &callback : m_printCallbacks) {
-    callback(v, buf.data());
+    callback(v, buf);
   }
-  trace(buf.data());
+  trace("{}", buf);
 }
 
 void ScriptEngine::registerGlobalFunction(SQFUNCTION f, const SQChar *functionName, SQInteger nparamscheck,
@@ -344,39 +363,52 @@ void ScriptEngine::executeScript(const std::string &name) {
 }
 
 void ScriptEngine::executeNutScript(const std::string &name) {
-  std::vector<char> code;
+  auto &settings = Locator<EngineSettings>::get();
+  auto &pCache = Locator<ScriptEngine>::get().m_pCache;
+  if (!pCache) {
+    // the compiler inlines the constants declared by the engine, they are part of the keys
+    pCache = std::make_unique<ScriptCache>(settings.getPath() / "cache", m_vm);
+  }
+  auto &cache = *pCache;
+  EntryView code;
+  std::vector<char> buffer;
 
-  std::ifstream is(name);
-  if (is.is_open()) {
+  const auto *pEntry = settings.getEntry(name);
+  const auto isLocal = pEntry && !pEntry->file.empty();
+  if (isLocal) {
     trace("Load local file file {}", name);
-    is.seekg(-1, std::ios::end);
-    auto len = (size_t) is.tellg();
-    is.seekg(0, std::ios::beg);
-    code.resize(len + 1);
-    is.read(code.data(), len);
+    code = settings.readView(name);
   } else {
     auto entryName = std::regex_replace(name, std::regex("\\.nut"), ".bnut");
-    code = Locator<EngineSettings>::get().readBuffer(entryName);
+    buffer = settings.readBuffer(entryName);
+  }
 
-    // decode bnut
-    int cursor = static_cast<int>(code.size() - 1) & 0xff;
-    for (char &i : code) {
-      i ^= _bnutPass[cursor];
-      cursor = (cursor + 1) % 4096;
+  // the key is computed on the encoded content, a cached script doesn't need to be decoded
+  auto key = isLocal ? cache.computeKey(code.data(), code.size()) : cache.computeKey(buffer.data(), buffer.size());
+
+  auto top = sq_gettop(m_vm);
+  sq_pushroottable(m_vm);
+  if (!cache.load(m_vm, name, key)) {
+    if (!isLocal) {
+      // the last byte is not part of the script
+      decodeBnut(buffer.data(), buffer.size());
+      if (!buffer.empty())
+        buffer.pop_back();
+      code = EntryView(std::move(buffer));
     }
-  }
 
 #if 0
-  std::ofstream o;
-  o.open(name);
-  o.write(code.data(), code.size());
-  o.close();
+    std::ofstream o;
+    o.open(name);
+    o.write(code.data(), code.size());
+    o.close();
 #endif
-  auto top = sq_gettop(m_vm);
-  sq_pushroottable(m_vm);
-  if (SQ_FAILED(sq_compilebuffer(m_vm, code.data(), code.size() - 1, _SC(name.data()), SQTrue))) {
-    error("Error compiling {}", name);
-    return;
+    ConstantsSnapshot constants(m_vm);
+    if (SQ_FAILED(sq_compilebuffer(m_vm, code.data(), code.size(), _SC(name.data()), SQTrue))) {
+      error("Error compiling {}", name);
+      return;
+    }
+    cache.save(m_vm, name, key, constants);
   }
   sq_push(m_vm, -2);
   // call
@@ -435,6 +467,20 @@ SQObjectPtr ScriptEngine::toSquirrel(const std::string &value) {
   return string;
 }
 
+HSQOBJECT ScriptEngine::getRootTable() {
+  sq_pushroottable(m_vm);
+  HSQOBJECT rootTable;
+  sq_getstackobj(m_vm, -1, &rootTable);
+  sq_pop(m_vm, 1);
+  return rootTable;
+}
+
+SQUnsignedInteger ScriptEngine::getVersion(HSQOBJECT table) {
+  if (!sq_istable(table))
+    return 0;
+  return _table(table)->GetVersion();
+}
+
 Engine *ScriptEngine::g_pEngine = nullptr;
 
 } // namespace ng
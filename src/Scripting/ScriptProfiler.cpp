@@ -0,0 +1,174 @@
+#include <algorithm>
+#include <fstream>
+#include "engge/Engine/Cutscene.hpp"
+#include "engge/Engine/Engine.hpp"
+#include "engge/Engine/ThreadBase.hpp"
+#include "engge/Scripting/ScriptEngine.hpp"
+#include "engge/System/Locator.hpp"
+#include "engge/System/Logger.hpp"
+#include "ScriptProfiler.hpp"
+
+namespace ng {
+namespace {
+// natives have no source, this keeps them apart from the closures without one
+const SQChar *const NativeSource = _SC("<native>");
+
+std::string escapeCsv(const std::string &text) {
+  std::string result{"\""};
+  for (auto c : text) {
+    if (c == '"')
+      result += '"';
+    result += c;
+  }
+  result += '"';
+  return result;
+}
+}
+
+void ScriptProfiler::setEnabled(bool enabled) {
+  if (m_enabled == enabled)
+    return;
+  m_enabled = enabled;
+  m_stacks.clear();
+
+  // threads created later inherit the hook of the VM creating them
+  setHook(ScriptEngine::getVm(), enabled);
+  auto &engine = Locator<Engine>::get();
+  for (auto &thread : engine.getThreads()) {
+    setHook(thread->getThread(), enabled);
+  }
+  auto pCutscene = engine.getCutscene();
+  if (pCutscene) {
+    setHook(pCutscene->getThread(), enabled);
+  }
+}
+
+void ScriptProfiler::setHook(HSQUIRRELVM v, bool enabled) {
+  if (!v)
+    return;
+  sq_setnativedebughook(v, enabled ? hook : nullptr);
+}
+
+void ScriptProfiler::suspend(HSQUIRRELVM v) {
+  if (!m_enabled)
+    return;
+  auto it = m_stacks.find(v);
+  if (it == m_stacks.end() || it->second.isSuspended)
+    return;
+  auto now = clock::now();
+  for (auto &frame : it->second.frames) {
+    frame.elapsed += now - frame.start;
+  }
+  it->second.isSuspended = true;
+}
+
+void ScriptProfiler::resume(HSQUIRRELVM v) {
+  if (!m_enabled)
+    return;
+  auto it = m_stacks.find(v);
+  if (it == m_stacks.end() || !it->second.isSuspended)
+    return;
+  auto now = clock::now();
+  for (auto &frame : it->second.frames) {
+    frame.start = now;
+  }
+  it->second.isSuspended = false;
+}
+
+void ScriptProfiler::remove(HSQUIRRELVM v) {
+  m_stacks.erase(v);
+}
+
+void ScriptProfiler::reset() {
+  m_entries.clear();
+  m_entriesByKey.clear();
+  m_stacks.clear();
+}
+
+bool ScriptProfiler::save(const std::filesystem::path &path) {
+  std::ofstream os(path);
+  if (!os.is_open()) {
+    error("Failed to save script profile to {}", path.string());
+    return false;
+  }
+  os << "name,source,native,calls,inclusive_ms,self_ms\n";
+  for (const auto &entry : m_entries) {
+    os << escapeCsv(entry.name) << ',' << escapeCsv(entry.source) << ',' << (entry.isNative ? 1 : 0) << ','
+       << entry.calls << ','
+       << std::chrono::duration<double, std::milli>(entry.inclusive).count() << ','
+       << std::chrono::duration<double, std::milli>(entry.self).count() << '\n';
+  }
+  info("Script profile saved to {}", path.string());
+  return true;
+}
+
+void ScriptProfiler::hook(HSQUIRRELVM v, SQInteger type, const SQChar *sourceName, SQInteger, const SQChar *funcName) {
+  switch (type) {
+  case 'c':push(v, getEntry(sourceName, funcName, false));
+    break;
+  case 'n':push(v, getEntry(NativeSource, funcName, true));
+    break;
+  case 'r':
+  case 'x':pop(v);
+    break;
+  default:break;
+  }
+}
+
+std::size_t ScriptProfiler::getEntry(const SQChar *sourceName, const SQChar *funcName, bool isNative) {
+  // the strings are interned by the VM but an address can be reused once a string is released,
+  // so the entries are identified by the contents
+  std::string_view name = funcName ? funcName : "<anonymous>";
+  std::string_view source = isNative ? "" : (sourceName ? sourceName : "<unknown>");
+  auto key = std::hash<std::string_view>()(name) ^ (std::hash<std::string_view>()(source) << 1)
+      ^ static_cast<std::size_t>(isNative);
+  auto &indices = m_entriesByKey[key];
+  for (auto index : indices) {
+    const auto &entry = m_entries[index];
+    if (entry.isNative == isNative && entry.name == name && entry.source == source)
+      return index;
+  }
+
+  ScriptProfilerEntry entry;
+  entry.name = name;
+  entry.source = source;
+  entry.isNative = isNative;
+  m_entries.push_back(std::move(entry));
+  auto index = m_entries.size() - 1;
+  indices.push_back(index);
+  return index;
+}
+
+void ScriptProfiler::push(HSQUIRRELVM v, std::size_t entry) {
+  auto &stack = m_stacks[v];
+  Frame frame;
+  frame.entry = entry;
+  frame.start = clock::now();
+  stack.frames.push_back(frame);
+  m_entries[entry].calls++;
+}
+
+void ScriptProfiler::pop(HSQUIRRELVM v) {
+  auto it = m_stacks.find(v);
+  // the profiler can be enabled while functions are already running
+  if (it == m_stacks.end() || it->second.frames.empty())
+    return;
+
+  auto &stack = it->second;
+  auto frame = stack.frames.back();
+  stack.frames.pop_back();
+  auto elapsed = frame.elapsed;
+  if (!stack.isSuspended)
+    elapsed += clock::now() - frame.start;
+
+  auto &entry = m_entries[frame.entry];
+  // recursive calls are already counted by the outermost call
+  auto isRecursive = std::any_of(stack.frames.cbegin(), stack.frames.cend(),
+                                 [&frame](const auto &f) { return f.entry == frame.entry; });
+  if (!isRecursive)
+    entry.inclusive += elapsed;
+  entry.self += elapsed - frame.children;
+  if (!stack.frames.empty())
+    stack.frames.back().children += elapsed;
+}
+}
@@ -0,0 +1,74 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <squirrel.h>
+
+namespace ng {
+/// @brief Statistics collected for a script function or a native binding.
+struct ScriptProfilerEntry {
+  std::string name;
+  std::string source;
+  bool isNative{false};
+  std::uint64_t calls{0};
+  /// Time spent in the function, including the functions it called.
+  std::chrono::nanoseconds inclusive{0};
+  /// Time spent in the function itself.
+  std::chrono::nanoseconds self{0};
+};
+
+/// @brief Instrumenting profiler built on the native debug hook of Squirrel.
+/// @details The hook reports the calls and returns of the script functions ('c' and 'r') and of the
+/// native bindings ('n' and 'x'). Each VM keeps its own call stack, the time a thread spends
+/// suspended is not attributed to the functions on its stack.
+class ScriptProfiler {
+public:
+  static void setEnabled(bool enabled);
+  [[nodiscard]] static bool isEnabled() { return m_enabled; }
+
+  /// Stops the clock of the functions on the stack of this VM.
+  static void suspend(HSQUIRRELVM v);
+  /// Restarts the clock of the functions on the stack of this VM.
+  static void resume(HSQUIRRELVM v);
+  /// Forgets the stack of this VM, it has to be called before the VM is released.
+  static void remove(HSQUIRRELVM v);
+
+  static void reset();
+  [[nodiscard]] static const std::vector<ScriptProfilerEntry> &getEntries() { return m_entries; }
+  /// Exports the entries to a CSV file.
+  static bool save(const std::filesystem::path &path);
+
+private:
+  using clock = std::chrono::steady_clock;
+
+  struct Frame {
+    std::size_t entry{0};
+    clock::time_point start;
+    std::chrono::nanoseconds elapsed{0};
+    std::chrono::nanoseconds children{0};
+  };
+
+  struct Stack {
+    std::vector<Frame> frames;
+    bool isSuspended{false};
+  };
+
+  static void hook(HSQUIRRELVM v, SQInteger type, const SQChar *sourceName, SQInteger line, const SQChar *funcName);
+  static void setHook(HSQUIRRELVM v, bool enabled);
+  static std::size_t getEntry(const SQChar *sourceName, const SQChar *funcName, bool isNative);
+  static void push(HSQUIRRELVM v, std::size_t entry);
+  static void pop(HSQUIRRELVM v);
+
+private:
+  inline static bool m_enabled{false};
+  inline static std::vector<ScriptProfilerEntry> m_entries;
+  // indices of the entries by hash of their name and source
+  inline static std::unordered_map<std::size_t, std::vector<std::size_t>> m_entriesByKey;
+  inline static std::unordered_map<HSQUIRRELVM, Stack> m_stacks;
+};
+}
@@ -18,6 +18,7 @@
 #include <engge/Audio/SoundId.hpp>
 #include <engge/Audio/SoundManager.hpp>
 #include <engge/Engine/Thread.hpp>
+#include <engge/Engine/ThreadPool.hpp>
 #include <Engine/AchievementManager.hpp>
 #include "Util/Util.hpp"
 
@@ -93,6 +94,10 @@ public:
     auto animControl = m_actor.getCostume().getAnimControl();
     return animControl.getAnimation() != m_pAnimation || animControl.getState() != AnimState::Play;
   }
+
+  [[nodiscard]] std::optional<WaitKey> getWaitKey() const override {
+    return WaitKey{WaitEvent::Animation, m_pAnimation};
+  }
 };
 
 class BreakWhileAnimatingObjectFunction final : public BreakFunction {
@@ -112,6 +117,10 @@ public:
   bool isElapsed() override {
     return !m_animation.has_value() || m_object.getAnimControl().getState() != AnimState::Play;
   }
+
+  [[nodiscard]] std::optional<WaitKey> getWaitKey() const override {
+    return WaitKey{WaitEvent::Animation, m_object.getAnimControl().getAnimation()};
+  }
 };
 
 class BreakWhileWalkingFunction final : public BreakFunction {
@@ -130,6 +139,10 @@ public:
   bool isElapsed() override {
     return !m_actor.isWalking();
   }
+
+  [[nodiscard]] std::optional<WaitKey> getWaitKey() const override {
+    return WaitKey{WaitEvent::Walk, &m_actor};
+  }
 };
 
 class BreakWhileTalkingFunction final : public BreakFunction {
@@ -148,6 +161,10 @@ public:
   bool isElapsed() override {
     return !m_entity.isTalking();
   }
+
+  [[nodiscard]] std::optional<WaitKey> getWaitKey() const override {
+    return WaitKey{WaitEvent::Talk, &m_entity};
+  }
 };
 
 class BreakWhileAnyActorTalkingFunction final : public BreakFunction {
@@ -167,6 +184,10 @@ public:
     }
     return true;
   }
+
+  [[nodiscard]] std::optional<WaitKey> getWaitKey() const override {
+    return WaitKey{WaitEvent::Talk, nullptr};
+  }
 };
 
 class BreakWhileSoundFunction final : public BreakFunction {
@@ -186,6 +207,10 @@ public:
     auto pSoundId = dynamic_cast<SoundId *>(EntityManager::getSoundFromId(m_soundId));
     return !pSoundId || !pSoundId->isPlaying();
   }
+
+  [[nodiscard]] std::optional<WaitKey> getWaitKey() const override {
+    return WaitKey{WaitEvent::Sound, dynamic_cast<const SoundId *>(EntityManager::getSoundFromId(m_soundId))};
+  }
 };
 
 class BreakWhileRunningFunction final : public Function {
@@ -839,8 +864,8 @@ private:
     }
 
     auto vm = ScriptEngine::getVm();
-    // create thread and store it on the stack
-    sq_newthread(vm, 1024);
+    // get a thread from the pool and store it on the stack
+    g_pEngine->getThreadPool().acquire(vm);
     HSQOBJECT thread_obj;
     sq_resetobject(&thread_obj);
     if (SQ_FAILED(sq_getstackobj(vm, -1, &thread_obj))) {
@@ -905,7 +930,7 @@ private:
 
     pThread->suspend();
 
-    g_pEngine->addFunction(std::make_unique<BreakTimeFunction>(pThread->getId(), ngf::TimeSpan::seconds(time)));
+    g_pEngine->addTimer(std::make_unique<BreakTimeFunction>(pThread->getId(), ngf::TimeSpan::seconds(time)));
     return SQ_SUSPEND_FLAG;
   }
 
@@ -2,6 +2,7 @@
 #include <engge/Scripting/ScriptEngine.hpp>
 #include <engge/Room/Room.hpp>
 #include <engge/Engine/InputStateConstants.hpp>
+#include <engge/Engine/Preferences.hpp>
 #include "Engine/DebugFeatures.hpp"
 #include "../../extlibs/squirrel/squirrel/sqpcheader.h"
 #include "../../extlibs/squirrel/squirrel/sqvm.h"
@@ -28,6 +29,8 @@ DebugTools::DebugTools(Engine &engine)
                      m_showGlobalsTable,
                      m_soundTools.soundsVisible,
                      m_threadTools.threadsVisible,
+                     m_profilerTools.profilerVisible,
+                     m_frameProfilerTools.frameProfilerVisible,
                      m_actorTools.actorsVisible,
                      m_objectTools.objectsVisible),
       m_cameraTools(engine),
@@ -55,6 +58,8 @@ void DebugTools::render() {
   m_roomTools.render();
   m_soundTools.render();
   m_threadTools.render();
+  m_profilerTools.render();
+  m_frameProfilerTools.render();
   showRoomTable();
   showPerformance();
 
@@ -67,6 +72,13 @@ void DebugTools::showPerformance() {
 
   renderTimes("Rendering (ms)", m_renderTimes, []() { return DebugFeatures::renderTime; });
   renderTimes("Update (ms)", m_updateTimes, []() { return DebugFeatures::updateTime; });
+
+  auto updateRate = m_engine.getPreferences().getUserPreference(PreferenceNames::EnggeUpdateRate,
+                                                                PreferenceDefaultValues::EnggeUpdateRate);
+  if (ImGui::InputInt("Update rate (Hz)", &updateRate)) {
+    m_engine.getPreferences().setUserPreference(PreferenceNames::EnggeUpdateRate, std::max(0, updateRate));
+  }
+  ImGui::Text("Update steps: %d", DebugFeatures::updateSteps);
 }
 
 void DebugTools::renderTimes(const char *label, Plot &plot, const std::function<ngf::TimeSpan()> &func) {
@@ -2,6 +2,7 @@
 #include <optional>
 #include <functional>
 #include "ConsoleTools.hpp"
+#include "FrameProfilerTools.hpp"
 #include "TextureTools.hpp"
 #include "DebugControls.hpp"
 #include "ActorTools.hpp"
@@ -12,6 +13,7 @@
 #include "GeneralTools.hpp"
 #include "CameraTools.hpp"
 #include "PreferencesTools.hpp"
+#include "ProfilerTools.hpp"
 
 namespace ng {
 class Engine;
@@ -48,6 +50,8 @@ private:
   RoomTools m_roomTools;
   SoundTools m_soundTools;
   ThreadTools m_threadTools;
+  ProfilerTools m_profilerTools;
+  FrameProfilerTools m_frameProfilerTools;
   GeneralTools m_generalTools;
   CameraTools m_cameraTools;
   PreferencesTools m_preferencesTools;
@@ -0,0 +1,114 @@
+#include "FrameProfilerTools.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <chrono>
+#include <functional>
+#include <string_view>
+#include <imgui.h>
+#include <imgui_stdlib.h>
+#include "System/FrameProfiler.hpp"
+
+namespace ng {
+FrameProfilerTools::FrameProfilerTools() = default;
+
+#if ENGGE_FRAME_PROFILER
+namespace {
+float toMilliseconds(std::chrono::nanoseconds time) {
+  return std::chrono::duration<float, std::milli>(time).count();
+}
+
+ImU32 getZoneColor(const char *name) {
+  // the same zone keeps the same color from one frame to the next
+  auto hash = std::hash<std::string_view>()(name);
+  return ImColor::HSV(static_cast<float>(hash % 360) / 360.f, 0.5f, 0.8f);
+}
+
+void renderFlameGraph(const FrameProfilerFrame &frame) {
+  const auto rowHeight = ImGui::GetTextLineHeightWithSpacing();
+  auto depth = 0;
+  for (const auto &zone : frame.zones) {
+    depth = std::max(depth, zone.depth + 1);
+  }
+
+  auto origin = ImGui::GetCursorScreenPos();
+  auto width = std::max(ImGui::GetContentRegionAvail().x, 1.f);
+  auto frameTime = std::max(toMilliseconds(frame.duration), 0.001f);
+  auto scale = width / frameTime;
+  auto pDrawList = ImGui::GetWindowDrawList();
+  ImGui::InvisibleButton("FlameGraph", ImVec2(width, rowHeight * static_cast<float>(std::max(depth, 1))));
+  auto isHovered = ImGui::IsItemHovered();
+  auto mouse = ImGui::GetIO().MousePos;
+
+  for (const auto &zone : frame.zones) {
+    auto start = toMilliseconds(zone.start);
+    auto duration = toMilliseconds(zone.duration);
+    ImVec2 topLeft{origin.x + start * scale, origin.y + static_cast<float>(zone.depth) * rowHeight};
+    ImVec2 bottomRight{topLeft.x + std::max(duration * scale, 1.f), topLeft.y + rowHeight - 1.f};
+    pDrawList->AddRectFilled(topLeft, bottomRight, getZoneColor(zone.name));
+    auto textSize = ImGui::CalcTextSize(zone.name);
+    if (textSize.x + 4.f < bottomRight.x - topLeft.x) {
+      pDrawList->PushClipRect(topLeft, bottomRight, true);
+      pDrawList->AddText(ImVec2(topLeft.x + 2.f, topLeft.y), IM_COL32_BLACK, zone.name);
+      pDrawList->PopClipRect();
+    }
+    if (isHovered && mouse.x >= topLeft.x && mouse.x < bottomRight.x && mouse.y >= topLeft.y
+        && mouse.y < bottomRight.y) {
+      ImGui::SetTooltip("%s: %.3f ms", zone.name, duration);
+    }
+  }
+}
+}
+
+void FrameProfilerTools::render() {
+  if (!frameProfilerVisible)
+    return;
+
+  ImGui::Begin("Frame profiler", &frameProfilerVisible);
+  auto paused = FrameProfiler::isPaused();
+  if (ImGui::Checkbox("Pause", &paused)) {
+    FrameProfiler::setPaused(paused);
+  }
+  ImGui::SameLine();
+  auto maxAge = static_cast<int>(std::max<std::size_t>(FrameProfiler::getFrameCount(), 1)) - 1;
+  m_frameAge = std::clamp(m_frameAge, 0, maxAge);
+  ImGui::SliderInt("Frame age", &m_frameAge, 0, maxAge);
+
+  ImGui::InputText("File", &m_path);
+  ImGui::InputInt("Frames", &m_traceFrames);
+  ImGui::SameLine();
+  if (FrameProfiler::isCapturing()) {
+    ImGui::TextUnformatted("Capturing...");
+  } else if (ImGui::SmallButton("Capture trace")) {
+    FrameProfiler::captureTrace(m_path, m_traceFrames);
+  }
+  ImGui::Separator();
+
+  if (FrameProfiler::getFrameCount() == 0) {
+    ImGui::End();
+    return;
+  }
+
+  // plot of the last frames, the selected one is shown below
+  float times[FrameProfiler::HistorySize];
+  auto count = static_cast<int>(FrameProfiler::getFrameCount());
+  for (int i = 0; i < count; ++i) {
+    times[i] = toMilliseconds(FrameProfiler::getFrame(count - 1 - i).duration);
+  }
+  ImGui::PlotHistogram("Frames (ms)", times, count, 0, nullptr, 0.f, FLT_MAX, ImVec2(0, 60));
+
+  const auto &frame = FrameProfiler::getFrame(static_cast<std::size_t>(m_frameAge));
+  ImGui::Text("Frame: %.3f ms, %d zones", toMilliseconds(frame.duration), static_cast<int>(frame.zones.size()));
+  renderFlameGraph(frame);
+  ImGui::End();
+}
+#else
+void FrameProfilerTools::render() {
+  if (!frameProfilerVisible)
+    return;
+
+  ImGui::Begin("Frame profiler", &frameProfilerVisible);
+  ImGui::TextUnformatted("The frame profiler is disabled in this build (ENGGE_FRAME_PROFILER).");
+  ImGui::End();
+}
+#endif
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include <string>
+
+namespace ng {
+class FrameProfilerTools final {
+public:
+  FrameProfilerTools();
+
+  void render();
+
+public:
+  bool frameProfilerVisible{false};
+
+private:
+  std::string m_path{"frame_trace.json"};
+  int m_traceFrames{300};
+  int m_frameAge{0};
+};
+}
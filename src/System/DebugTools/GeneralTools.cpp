@@ -22,11 +22,14 @@ GeneralTools::GeneralTools(Engine &engine,
                            bool &showGlobalsTable,
                            bool &soundsVisible,
                            bool &threadsVisible,
+                           bool &profilerVisible,
+                           bool &frameProfilerVisible,
                            bool &actorsVisible,
                            bool &objectsVisible)
     : m_engine(engine), m_textureVisible(textureVisible), m_consoleVisible(consoleVisible),
       m_showGlobalsTable(showGlobalsTable), m_soundsVisible(soundsVisible), m_threadsVisible(threadsVisible),
-      m_actorsVisible(actorsVisible), m_objectsVisible(objectsVisible) {}
+      m_profilerVisible(profilerVisible), m_frameProfilerVisible(frameProfilerVisible), m_actorsVisible(actorsVisible),
+      m_objectsVisible(objectsVisible) {}
 
 void GeneralTools::render() {
   std::stringstream s;
@@ -68,6 +71,8 @@ void GeneralTools::render() {
   ImGui::Checkbox("Sounds", &m_soundsVisible);
   ImGui::Checkbox("Textures", &m_textureVisible);
   ImGui::Checkbox("Threads", &m_threadsVisible);
+  ImGui::Checkbox("Script profiler", &m_profilerVisible);
+  ImGui::Checkbox("Frame profiler", &m_frameProfilerVisible);
   ImGui::Checkbox("Console", &m_consoleVisible);
   ImGui::SameLine();
   if (ImGui::SmallButton("Globals...")) {
@@ -8,7 +8,8 @@ class Engine;
 class GeneralTools final {
 public:
   explicit GeneralTools(Engine &engine, bool &textureVisible, bool &consoleVisible, bool &showGlobalsTable,
-                        bool &soundsVisible, bool & threadsVisible, bool & actorsVisible, bool &objectsVisible);
+                        bool &soundsVisible, bool & threadsVisible, bool &profilerVisible, bool &frameProfilerVisible,
+                        bool & actorsVisible, bool &objectsVisible);
 
   void render();
 
@@ -23,6 +24,8 @@ private:
   bool &m_showGlobalsTable;
   bool& m_soundsVisible;
   bool& m_threadsVisible;
+  bool& m_profilerVisible;
+  bool& m_frameProfilerVisible;
   bool& m_actorsVisible;
   bool& m_objectsVisible;
 };
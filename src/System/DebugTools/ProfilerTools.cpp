@@ -0,0 +1,76 @@
+#include "ProfilerTools.hpp"
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <imgui.h>
+#include <imgui_stdlib.h>
+#include "Scripting/ScriptProfiler.hpp"
+
+namespace ng {
+namespace {
+float toMilliseconds(std::chrono::nanoseconds time) {
+  return std::chrono::duration<float, std::milli>(time).count();
+}
+}
+
+ProfilerTools::ProfilerTools() = default;
+
+void ProfilerTools::render() {
+  if (!profilerVisible)
+    return;
+
+  ImGui::Begin("Script profiler", &profilerVisible);
+  auto enabled = ScriptProfiler::isEnabled();
+  if (ImGui::Checkbox("Enabled", &enabled)) {
+    ScriptProfiler::setEnabled(enabled);
+  }
+  ImGui::SameLine();
+  if (ImGui::SmallButton("Reset")) {
+    ScriptProfiler::reset();
+  }
+  ImGui::SameLine();
+  ImGui::Checkbox("Natives", &m_showNatives);
+  ImGui::InputText("File", &m_path);
+  ImGui::SameLine();
+  if (ImGui::SmallButton("Export")) {
+    ScriptProfiler::save(m_path);
+  }
+  ImGui::Separator();
+
+  std::vector<const ScriptProfilerEntry *> entries;
+  for (const auto &entry : ScriptProfiler::getEntries()) {
+    if (!m_showNatives && entry.isNative)
+      continue;
+    entries.push_back(&entry);
+  }
+  std::sort(entries.begin(), entries.end(), [](const auto *e1, const auto *e2) { return e1->self > e2->self; });
+
+  if (ImGui::BeginTable("Profile",
+                        5,
+                        ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_Resizable
+                            | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY)) {
+    ImGui::TableSetupColumn("Name");
+    ImGui::TableSetupColumn("Source");
+    ImGui::TableSetupColumn("Calls");
+    ImGui::TableSetupColumn("Inclusive (ms)");
+    ImGui::TableSetupColumn("Self (ms)");
+    ImGui::TableHeadersRow();
+
+    for (const auto *entry : entries) {
+      ImGui::TableNextRow();
+      ImGui::TableNextColumn();
+      ImGui::Text("%s%s", entry->name.c_str(), entry->isNative ? " [native]" : "");
+      ImGui::TableNextColumn();
+      ImGui::Text("%s", entry->source.c_str());
+      ImGui::TableNextColumn();
+      ImGui::Text("%8llu", static_cast<unsigned long long>(entry->calls));
+      ImGui::TableNextColumn();
+      ImGui::Text("%10.3f", toMilliseconds(entry->inclusive));
+      ImGui::TableNextColumn();
+      ImGui::Text("%10.3f", toMilliseconds(entry->self));
+    }
+    ImGui::EndTable();
+  }
+  ImGui::End();
+}
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include <string>
+
+namespace ng {
+class ProfilerTools final {
+public:
+  ProfilerTools();
+
+  void render();
+
+public:
+  bool profilerVisible{false};
+
+private:
+  std::string m_path{"script_profile.csv"};
+  bool m_showNatives{true};
+};
+}
@@ -9,33 +9,45 @@ void TextureTools::render() {
     return;
 
   ImGui::Begin("Textures", &texturesVisible);
-  const auto &map = Locator<ResourceManager>::get().getTextureMap();
+  auto &resourceManager = Locator<ResourceManager>::get();
+  const auto &map = resourceManager.getTextureMap();
   size_t totalSize = 0;
   for (const auto&[key, value] :map) {
     totalSize += value.size;
   }
   auto totalSizeText = convertSize(totalSize);
-  ImGui::Text("Total memory: %s", totalSizeText.data());
+  auto memoryText = convertSize(resourceManager.getTextureMemory());
+  auto budgetText = convertSize(resourceManager.getTextureBudget());
+  ImGui::Text("Total file size: %s", totalSizeText.data());
+  ImGui::Text("Total memory: %s / %s", memoryText.data(), budgetText.data());
+  ImGui::Text("Pending: %lu", resourceManager.getPendingTextureCount());
   ImGui::Separator();
 
   if (ImGui::BeginTable("Textures",
-                        3,
+                        5,
                         ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_Resizable
                             | ImGuiTableFlags_RowBg)) {
     ImGui::TableSetupColumn("Name");
-    ImGui::TableSetupColumn("Size");
+    ImGui::TableSetupColumn("File size");
+    ImGui::TableSetupColumn("Memory");
     ImGui::TableSetupColumn("Refs");
+    ImGui::TableSetupColumn("Last used");
     ImGui::TableHeadersRow();
 
     for (const auto&[key, value] :map) {
       auto fileSize = convertSize(value.size);
+      auto memorySize = convertSize(value.memorySize);
       ImGui::TableNextRow();
       ImGui::TableNextColumn();
       ImGui::Text("%s", key.data());
       ImGui::TableNextColumn();
       ImGui::Text("%s", fileSize.data());
       ImGui::TableNextColumn();
+      ImGui::Text("%s", memorySize.data());
+      ImGui::TableNextColumn();
       ImGui::Text("%ld", value.texture.use_count());
+      ImGui::TableNextColumn();
+      ImGui::Text("%d", value.lastUsedFrame);
     }
     ImGui::EndTable();
   }
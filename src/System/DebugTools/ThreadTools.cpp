@@ -1,6 +1,7 @@
 #include "ThreadTools.hpp"
 #include <engge/Engine/Engine.hpp>
 #include <engge/Engine/ThreadBase.hpp>
+#include <engge/Engine/ThreadPool.hpp>
 #include <imgui.h>
 #include <string>
 
@@ -45,6 +46,11 @@ void ThreadTools::render() {
   const auto &threads = m_engine.getThreads();
   ImGui::Begin("Threads", &threadsVisible);
   ImGui::Text("# threads: %lu", threads.size());
+  const auto &pool = m_engine.getThreadPool();
+  const auto &stats = pool.getStats();
+  ImGui::Text("Pool: %lu used, %lu free", pool.getUsedSize(), pool.getFreeSize());
+  ImGui::Text("Pool: %lu created, %lu reused, %lu recycled, %lu released",
+              stats.created, stats.reused, stats.recycled, stats.released);
   ImGui::Separator();
 
   if (ImGui::BeginTable("Threads",
@@ -0,0 +1,108 @@
+#include "FrameProfiler.hpp"
+#if ENGGE_FRAME_PROFILER
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include "engge/System/Logger.hpp"
+
+namespace ng {
+namespace {
+double toMicroseconds(std::chrono::nanoseconds time) {
+  return std::chrono::duration<double, std::micro>(time).count();
+}
+}
+
+void FrameProfiler::newFrame() {
+  auto now = clock::now();
+
+  // a zone still open when the frame ends is closed with it
+  while (!m_stack.empty()) {
+    end();
+  }
+
+  auto &frame = m_frames[m_current];
+  frame.duration = now - m_frameStart;
+  if (m_captureFramesLeft > 0) {
+    capture(frame);
+  }
+  if (m_captureRequested > 0) {
+    m_captureFramesLeft = m_captureRequested;
+    m_captureRequested = 0;
+    m_captureStart = now;
+  }
+
+  if (!m_paused) {
+    m_current = (m_current + 1) % HistorySize;
+    // the slot of the current frame is in the ring, it isn't a completed frame
+    m_frameCount = std::min(m_frameCount + 1, HistorySize - 1);
+  }
+  m_frames[m_current].zones.clear();
+  m_frameStart = now;
+}
+
+void FrameProfiler::begin(const char *name) {
+  auto &zones = m_frames[m_current].zones;
+  FrameProfilerZone zone;
+  zone.name = name;
+  zone.depth = static_cast<int>(m_stack.size());
+  zone.start = clock::now() - m_frameStart;
+  m_stack.push_back(zones.size());
+  zones.push_back(zone);
+}
+
+void FrameProfiler::end() {
+  if (m_stack.empty())
+    return;
+  auto &zone = m_frames[m_current].zones[m_stack.back()];
+  m_stack.pop_back();
+  zone.duration = (clock::now() - m_frameStart) - zone.start;
+}
+
+const FrameProfilerFrame &FrameProfiler::getFrame(std::size_t age) {
+  return m_frames[(m_current + HistorySize - 1 - std::min(age, HistorySize - 2)) % HistorySize];
+}
+
+void FrameProfiler::captureTrace(const std::filesystem::path &path, int frames) {
+  // the capture starts with the next frame, the current one is already partially recorded
+  m_tracePath = path;
+  m_traceEvents.clear();
+  m_captureFramesLeft = 0;
+  m_captureRequested = std::max(1, frames);
+}
+
+void FrameProfiler::capture(const FrameProfilerFrame &frame) {
+  auto offset = m_frameStart - m_captureStart;
+  m_traceEvents.push_back({"frame", offset, frame.duration});
+  for (const auto &zone : frame.zones) {
+    m_traceEvents.push_back({zone.name, offset + zone.start, zone.duration});
+  }
+  if (--m_captureFramesLeft == 0) {
+    saveTrace();
+    m_traceEvents.clear();
+  }
+}
+
+bool FrameProfiler::saveTrace() {
+  std::ofstream os(m_tracePath);
+  if (!os.is_open()) {
+    error("Failed to save frame trace to {}", m_tracePath.string());
+    return false;
+  }
+
+  // see the Trace Event Format: the complete events ('X') have a start and a duration in microseconds
+  os << std::fixed << std::setprecision(3);
+  os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  auto first = true;
+  for (const auto &event : m_traceEvents) {
+    if (!first)
+      os << ',';
+    first = false;
+    os << "\n{\"name\":\"" << event.name << "\",\"cat\":\"engge\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":"
+       << toMicroseconds(event.start) << ",\"dur\":" << toMicroseconds(event.duration) << '}';
+  }
+  os << "\n]}\n";
+  info("Frame trace saved to {} ({} events)", m_tracePath.string(), m_traceEvents.size());
+  return true;
+}
+}
+#endif
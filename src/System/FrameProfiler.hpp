@@ -0,0 +1,111 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <vector>
+
+/// The frame profiler is compiled in debug builds only, define ENGGE_FRAME_PROFILER to 0 or 1 to override it.
+#ifndef ENGGE_FRAME_PROFILER
+#ifdef NDEBUG
+#define ENGGE_FRAME_PROFILER 0
+#else
+#define ENGGE_FRAME_PROFILER 1
+#endif
+#endif
+
+#if ENGGE_FRAME_PROFILER
+#define ENGGE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define ENGGE_PROFILE_CONCAT(a, b) ENGGE_PROFILE_CONCAT_IMPL(a, b)
+/// Times the enclosing scope, the name has to be a string literal.
+#define ENGGE_PROFILE_SCOPE(name) ng::FrameProfilerScope ENGGE_PROFILE_CONCAT(profilerScope, __LINE__)(name)
+/// Times the code until the matching ENGGE_PROFILE_END, when a scope doesn't fit.
+#define ENGGE_PROFILE_BEGIN(name) ng::FrameProfiler::begin(name)
+#define ENGGE_PROFILE_END() ng::FrameProfiler::end()
+/// Ends the current frame and starts a new one.
+#define ENGGE_PROFILE_FRAME() ng::FrameProfiler::newFrame()
+#else
+#define ENGGE_PROFILE_SCOPE(name) (void)0
+#define ENGGE_PROFILE_BEGIN(name) (void)0
+#define ENGGE_PROFILE_END() (void)0
+#define ENGGE_PROFILE_FRAME() (void)0
+#endif
+
+#if ENGGE_FRAME_PROFILER
+namespace ng {
+/// @brief A timed scope of a frame.
+struct FrameProfilerZone {
+  const char *name{nullptr};
+  int depth{0};
+  /// Start of the zone relative to the start of the frame.
+  std::chrono::nanoseconds start{0};
+  std::chrono::nanoseconds duration{0};
+};
+
+struct FrameProfilerFrame {
+  std::chrono::nanoseconds duration{0};
+  std::vector<FrameProfilerZone> zones;
+};
+
+/// @brief Hierarchical profiler of the main thread.
+/// @details The zones of the last frames are kept in a ring buffer whose storage is reused, so a zone costs
+/// two clock reads. The frames can also be captured to a file in the Chrome trace event format, which can be
+/// opened in chrome://tracing or https://ui.perfetto.dev.
+class FrameProfiler {
+public:
+  static constexpr std::size_t HistorySize = 120;
+
+  static void newFrame();
+  static void begin(const char *name);
+  static void end();
+
+  /// When paused, the history is kept and the new frames are ignored.
+  static void setPaused(bool paused) { m_paused = paused; }
+  [[nodiscard]] static bool isPaused() { return m_paused; }
+
+  /// Gets a completed frame, 0 is the last one.
+  [[nodiscard]] static const FrameProfilerFrame &getFrame(std::size_t age);
+  [[nodiscard]] static std::size_t getFrameCount() { return m_frameCount; }
+
+  /// Captures the next frames and saves them to a trace file when done.
+  static void captureTrace(const std::filesystem::path &path, int frames);
+  [[nodiscard]] static bool isCapturing() { return m_captureRequested > 0 || m_captureFramesLeft > 0; }
+
+private:
+  using clock = std::chrono::steady_clock;
+
+  struct TraceEvent {
+    const char *name{nullptr};
+    std::chrono::nanoseconds start{0};
+    std::chrono::nanoseconds duration{0};
+  };
+
+  static void capture(const FrameProfilerFrame &frame);
+  static bool saveTrace();
+
+private:
+  inline static std::array<FrameProfilerFrame, HistorySize> m_frames;
+  inline static std::size_t m_current{0};
+  inline static std::size_t m_frameCount{0};
+  inline static clock::time_point m_frameStart{clock::now()};
+  inline static std::vector<std::size_t> m_stack;
+  inline static bool m_paused{false};
+
+  inline static std::filesystem::path m_tracePath;
+  inline static std::vector<TraceEvent> m_traceEvents;
+  inline static clock::time_point m_captureStart;
+  inline static int m_captureRequested{0};
+  inline static int m_captureFramesLeft{0};
+};
+
+/// @brief Times a scope of the current frame.
+class FrameProfilerScope {
+public:
+  explicit FrameProfilerScope(const char *name) { FrameProfiler::begin(name); }
+  ~FrameProfilerScope() { FrameProfiler::end(); }
+
+  FrameProfilerScope(const FrameProfilerScope &) = delete;
+  FrameProfilerScope &operator=(const FrameProfilerScope &) = delete;
+};
+}
+#endif
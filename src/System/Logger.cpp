@@ -1,3 +1,4 @@
+#include <chrono>
 #include <memory>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/sinks/basic_file_sink.h>
@@ -5,15 +6,59 @@
 #include "engge/System/Logger.hpp"
 
 namespace ng {
+namespace {
+constexpr auto FlushInterval = std::chrono::milliseconds(5);
+}
+
 Logger::Logger() {
   auto console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
   console_sink->set_level(spdlog::level::trace);
   auto file_sink = std::make_shared<spdlog::sinks::basic_file_sink_mt>("log.txt", true);
   file_sink->set_level(spdlog::level::trace);
-  auto dist_sink = std::make_shared<spdlog::sinks::dist_sink_st>();
+  auto dist_sink = std::make_shared<spdlog::sinks::dist_sink_mt>();
   dist_sink->add_sink(console_sink);
   dist_sink->add_sink(file_sink);
   m_out = std::make_shared<spdlog::logger>("log", dist_sink);
   m_out->set_level(spdlog::level::trace);
+  m_thread = std::thread(&Logger::run, this);
+}
+
+Logger::~Logger() {
+  m_done = true;
+  if (m_thread.joinable())
+    m_thread.join();
+  write();
+  m_out->flush();
+}
+
+void Logger::run() {
+  while (!m_done) {
+    if (write() == 0) {
+      std::this_thread::sleep_for(FlushInterval);
+    }
+  }
+}
+
+std::size_t Logger::write() {
+  auto count = m_queue.consume([this](const LogRecord &record) { write(record); });
+  auto dropped = m_queue.takeDropped();
+  if (dropped) {
+    m_out->warn("{} log messages dropped, the log queue was full", dropped);
+  }
+  return count;
+}
+
+void Logger::write(const LogRecord &record) {
+  // the message is given to the sinks directly to keep the time of the call instead of the time of the write
+  spdlog::details::log_msg msg(m_out->name(), record.level, string_view_t(record.text, record.size));
+  msg.time = record.time;
+  for (auto &sink : m_out->sinks()) {
+    if (sink->should_log(msg.level)) {
+      sink->log(msg);
+    }
+  }
+  if (msg.level >= spdlog::level::err) {
+    m_out->flush();
+  }
 }
 } // namespace ng
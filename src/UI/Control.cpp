@@ -1,5 +1,6 @@
 #include "Control.hpp"
-#include <ngf/System/Mouse.h>
+#include <engge/Input/InputSource.hpp>
+#include <engge/System/Locator.hpp>
 #include <imgui.h>
 #include <engge/Audio/SoundManager.hpp>
 #include <engge/Engine/Engine.hpp>
@@ -20,7 +21,7 @@ void Control::update(const ngf::TimeSpan &elapsed, glm::vec2 pos) {
   m_state = ControlState::None;
   if (contains((glm::vec2) pos)) {
     m_state = ControlState::Hover;
-    auto isDown = ngf::Mouse::isButtonPressed(ngf::Mouse::Button::Left);
+    auto isDown = Locator<InputSource>::get().isMouseButtonPressed(ngf::Mouse::Button::Left);
     auto &io = ImGui::GetIO();
     if (!io.WantCaptureMouse && m_wasMouseDown && !isDown) {
       onClick();
@@ -6,7 +6,8 @@
 #include <engge/Engine/Engine.hpp>
 #include <engge/Graphics/Screen.hpp>
 #include <ngf/Graphics/FntFont.h>
-#include <ngf/System/Mouse.h>
+#include <engge/Input/InputSource.hpp>
+#include <engge/System/Locator.hpp>
 #include <utility>
 #include "Util/Util.hpp"
 
@@ -135,7 +136,7 @@ struct HelpDialog::Impl {
     m_prev.setEngine(pEngine);
     m_next.setEngine(pEngine);
 
-    m_backgroundSprite.setTexture(*m_pEngine->getResourceManager().getTexture("HelpScreen_bg"));
+    m_backgroundSprite.setTexture(*m_pEngine->getResourceManager().getLoadedTexture("HelpScreen_bg"));
     m_backgroundSprite.getTransform().setPosition({Screen::HalfWidth, Screen::HalfHeight});
     m_backgroundSprite.setAnchor(ngf::Anchor::Center);
 
@@ -158,7 +159,7 @@ struct HelpDialog::Impl {
     sprintf(background, "HelpScreen_%02d_en", m_pages[index]);
     std::string backgroundWithLang = background;
     checkLanguage(backgroundWithLang);
-    m_helpPageSprite.setTexture(*m_pEngine->getResourceManager().getTexture(backgroundWithLang));
+    m_helpPageSprite.setTexture(*m_pEngine->getResourceManager().getLoadedTexture(backgroundWithLang));
     m_helpPageSprite.setAnchor(ngf::Anchor::Center);
   }
 
@@ -178,7 +179,7 @@ struct HelpDialog::Impl {
 
   void update(const ngf::TimeSpan &elapsed) {
     auto pos = m_pEngine->getApplication()->getRenderTarget()->mapPixelToCoords(
-        ngf::Mouse::getPosition(),
+        Locator<InputSource>::get().getMousePosition(),
         ngf::View(ngf::frect::fromPositionSize(
             {0, 0}, {Screen::Width, Screen::Height})));
     m_back.update(elapsed, pos);
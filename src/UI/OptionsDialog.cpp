@@ -17,7 +17,8 @@
 #include <utility>
 #include <ngf/Graphics/FntFont.h>
 #include <ngf/Graphics/RectangleShape.h>
-#include <ngf/System/Mouse.h>
+#include <engge/Input/InputSource.hpp>
+#include <engge/System/Locator.hpp>
 
 namespace ng {
 struct OptionsDialog::Impl {
@@ -477,7 +478,7 @@ struct OptionsDialog::Impl {
       return;
     }
 
-    auto pos = m_pEngine->getApplication()->getRenderTarget()->mapPixelToCoords(ngf::Mouse::getPosition(),
+    auto pos = m_pEngine->getApplication()->getRenderTarget()->mapPixelToCoords(Locator<InputSource>::get().getMousePosition(),
                                                                                 ngf::View(ngf::frect::fromPositionSize({0,
                                                                                                                        0},
                                                                                                                       {Screen::Width,
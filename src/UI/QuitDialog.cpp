@@ -9,7 +9,8 @@
 #include <ngf/Graphics/FntFont.h>
 #include <ngf/Graphics/RectangleShape.h>
 #include <ngf/Graphics/Sprite.h>
-#include <ngf/System/Mouse.h>
+#include <engge/Input/InputSource.hpp>
+#include <engge/System/Locator.hpp>
 #include "Util/Util.hpp"
 
 namespace ng {
@@ -163,7 +164,7 @@ struct QuitDialog::Impl {
 
   void update(const ngf::TimeSpan &elapsed) {
     auto pos = m_pEngine->getApplication()->getRenderTarget()->mapPixelToCoords(
-        ngf::Mouse::getPosition(),
+        Locator<InputSource>::get().getMousePosition(),
         ngf::View(ngf::frect::fromPositionSize(
             {0, 0}, {Screen::Width, Screen::Height})));
     for (auto &button : m_buttons) {
@@ -12,7 +12,7 @@
 #include <engge/Engine/EngineSettings.hpp>
 #include <engge/System/Locator.hpp>
 #include <engge/Engine/TextDatabase.hpp>
-#include <ngf/System/Mouse.h>
+#include <engge/Input/InputSource.hpp>
 #include "Button.hpp"
 #include "ControlConstants.hpp"
 #include "Util/Util.hpp"
@@ -281,7 +281,7 @@ struct SaveLoadDialog::Impl {
 
   void update(const ngf::TimeSpan &elapsed) {
     auto pos = m_pEngine->getApplication()->getRenderTarget()->mapPixelToCoords(
-        ngf::Mouse::getPosition(),
+        Locator<InputSource>::get().getMousePosition(),
         ngf::View(ngf::frect::fromPositionSize(
             {0, 0}, {Screen::Width, Screen::Height})));
     m_backButton.update(elapsed, pos);
@@ -289,7 +289,7 @@ struct SaveLoadDialog::Impl {
       slot.update(elapsed, pos);
     }
 
-    bool isDown = ngf::Mouse::isButtonPressed(ngf::Mouse::Button::Left);
+    bool isDown = Locator<InputSource>::get().isMouseButtonPressed(ngf::Mouse::Button::Left);
     const ImGuiIO &io = ImGui::GetIO();
     if (!io.WantCaptureMouse && m_wasMouseDown && !isDown) {
       int i = 0;
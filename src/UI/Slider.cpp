@@ -2,7 +2,8 @@
 #include <engge/Engine/Engine.hpp>
 #include <ngf/Graphics/FntFont.h>
 #include "ControlConstants.hpp"
-#include <ngf/System/Mouse.h>
+#include <engge/Input/InputSource.hpp>
+#include <engge/System/Locator.hpp>
 #include "Util/Util.hpp"
 #include <imgui.h>
 
@@ -47,7 +48,7 @@ void Slider::update(const ngf::TimeSpan &elapsed, glm::vec2 pos) {
   Control::update(elapsed, pos);
 
   auto textRect = ng::getGlobalBounds(m_sprite);
-  bool isDown = ngf::Mouse::isButtonPressed(ngf::Mouse::Button::Left);
+  bool isDown = Locator<InputSource>::get().isMouseButtonPressed(ngf::Mouse::Button::Left);
   if (!isDown) {
     m_isDragging = false;
   }
@@ -7,7 +7,8 @@
 #include <engge/UI/SaveLoadDialog.hpp>
 #include <engge/UI/StartScreenDialog.hpp>
 #include <utility>
-#include <ngf/System/Mouse.h>
+#include <engge/Input/InputSource.hpp>
+#include <engge/System/Locator.hpp>
 #include <engge/UI/QuitDialog.hpp>
 
 namespace ng {
@@ -148,7 +149,7 @@ struct StartScreenDialog::Impl {
         return;
       }
 
-      auto pos = m_pEngine->getApplication()->getRenderTarget()->mapPixelToCoords(ngf::Mouse::getPosition(),
+      auto pos = m_pEngine->getApplication()->getRenderTarget()->mapPixelToCoords(Locator<InputSource>::get().getMousePosition(),
                                                                                   ngf::View(ngf::frect::fromPositionSize(
                                                                                       {0,
                                                                                        0},
@@ -4,8 +4,7 @@
 
 namespace ng {
 RandomNumberGenerator::RandomNumberGenerator() {
-  time_t t;
-  setSeed(static_cast<long>(time(&t)));
+  setTimeSeed();
 }
 
 void RandomNumberGenerator::setSeed(long seed) {
@@ -15,6 +14,13 @@ void RandomNumberGenerator::setSeed(long seed) {
 
 long RandomNumberGenerator::getSeed() const { return m_seed; }
 
+void RandomNumberGenerator::setTimeSeed() {
+  if (m_isSeedFixed)
+    return;
+  time_t t;
+  setSeed(static_cast<long>(time(&t)));
+}
+
 long RandomNumberGenerator::generateLong(long min, long max) {
   max++;
   auto value = rand() % (max - min) + min;
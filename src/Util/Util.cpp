@@ -233,6 +233,12 @@ float length(const glm::vec2 &v) {
   return sqrtf(v.x * v.x + v.y * v.y);
 }
 
+glm::vec2 interpolatePosition(const glm::vec2 &previous, const glm::vec2 &current, float alpha, float maxDistance) {
+  if (alpha >= 1.f || distanceSquared(previous, current) > maxDistance * maxDistance)
+    return current;
+  return previous + (current - previous) * alpha;
+}
+
 const double EPS = 1E-9;
 
 double det(float a, float b, float c, float d) {
@@ -43,6 +43,11 @@ float distance(const glm::vec2 &v1, const glm::vec2 &v2);
 
 float length(const glm::vec2 &v);
 
+/// Interpolates a position between the two last updates, `alpha` is in [0,1].
+/// A move longer than `maxDistance` is a teleport and is not interpolated.
+glm::vec2 interpolatePosition(const glm::vec2 &previous, const glm::vec2 &current, float alpha,
+                              float maxDistance = 100.f);
+
 Facing toFacing(std::optional<UseDirection> direction);
 UseDirection toDirection(const std::string &text);
 Facing getOppositeFacing(Facing facing);
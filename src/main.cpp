@@ -1,8 +1,53 @@
+#include <cstdlib>
+#include <cstring>
+#include <string>
 #include "Engine/AchievementManager.hpp"
 #include "engge/EnggeApplication.hpp"
 
-int main(int, char *[]) {
+namespace {
+void setEnvironmentVariable(const char *name, const char *value) {
+  // a value set by the user is kept
+#ifdef _WIN32
+  if (std::getenv(name))
+    return;
+  _putenv_s(name, value);
+#else
+  setenv(name, value, 0);
+#endif
+}
+
+void parseOptions(int argc, char *argv[], ng::EnggeApplication &app) {
+  ng::HeadlessOptions headlessOptions;
+  auto isHeadless = false;
+  for (int i = 1; i < argc; ++i) {
+    auto hasValue = i + 1 < argc;
+    if (!std::strcmp(argv[i], "--headless")) {
+      isHeadless = true;
+    } else if (!std::strcmp(argv[i], "--frames") && hasValue) {
+      headlessOptions.frames = std::atoi(argv[++i]);
+    } else if (!std::strcmp(argv[i], "--fps") && hasValue) {
+      headlessOptions.frameRate = std::atoi(argv[++i]);
+    } else if (!std::strcmp(argv[i], "--input") && hasValue) {
+      headlessOptions.inputPath = argv[++i];
+    } else if (!std::strcmp(argv[i], "--record") && hasValue) {
+      app.setInputRecordingPath(argv[++i]);
+    } else if (!std::strcmp(argv[i], "--replay") && hasValue) {
+      app.setInputReplayPath(argv[++i]);
+    }
+  }
+
+  if (isHeadless) {
+    // SDL still needs a GL context for the textures and the shaders, but no window is shown and no audio device is opened
+    setEnvironmentVariable("SDL_VIDEODRIVER", "offscreen");
+    setEnvironmentVariable("SDL_AUDIODRIVER", "dummy");
+    app.setHeadless(headlessOptions);
+  }
+}
+}
+
+int main(int argc, char *argv[]) {
   ng::EnggeApplication app;
+  parseOptions(argc, argv, app);
   try {
     app.run();
     ng::Locator<ng::Engine>::reset();